@@ -11,7 +11,7 @@
 #ifndef __ARRAY2D_H_6CADCB82__
 #define __ARRAY2D_H_6CADCB82__
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 
 
 template <class T>
@@ -9,10 +9,13 @@ Author:  Hemmer
 */
 
 #include "AudioSample.h"
+#include "ThumbnailBuilder.h"
 
 // create sample by loading file from disk
 AudioSample::AudioSample(const File &sampleSource,
-                         const int &thumbnailLength) :
+                         ThumbnailBuilder *thumbnailBuilder,
+                         LoadMonitor *monitor,
+                         TimeSliceThread *streamThread) :
     // Files //////////////////////////////////////////////
     sampleFile(sampleSource), formatManager(),
     fileType(sampleSource.getFileExtension()),
@@ -23,8 +26,11 @@ AudioSample::AudioSample(const File &sampleSource,
     data(0), sampleSampleRate(0.0),
     sampleType(tFileSample),
 
+    // Storage (for long files) ///////////////
+    storageMode(sInMemory), stream(),
+
     // Thumbnails ///////////////////////////
-    thumbnailData(), thumbnailFinished(false)
+    thumbnail(), thumbnailLock()
 {
     formatManager.registerBasicFormats();
 
@@ -39,11 +45,63 @@ AudioSample::AudioSample(const File &sampleSource,
         // Can this even happen!? Better to be safe than sorry.
         if (sampleLength < 1) throw ("Zero length sample: " + sampleName);
 
-        numChannels = audioReader->numChannels;
-
-        data = new AudioSampleBuffer(jmin(2, (int) audioReader->numChannels), sampleLength);
+        numChannels = jmin(2, (int) audioReader->numChannels);
         sampleSampleRate = audioReader->sampleRate;
-        audioReader->read(data, 0, sampleLength, 0, true, true);
+
+        // Long files would eat up the memory (especially for 32-bit
+        // hosts) so read them straight from the disk instead.
+        const int64 decodedSize = (int64) sampleLength * numChannels * (int64) sizeof(float);
+        if (decodedSize > maxInMemoryBytes)
+        {
+            // Uncompressed files are mapped a block at a time (so we
+            // don't run out of address space), anything else is decoded
+            // a block at a time. Both need a thread to move the blocks.
+            AudioFormat *format = formatManager.findFormatForFileExtension(fileType);
+
+            OwnedArray<MemoryMappedAudioFormatReader> mappedReaders;
+            while (streamThread != nullptr && format != nullptr
+                   && mappedReaders.size() < SampleStream::numCacheBlocks)
+            {
+                MemoryMappedAudioFormatReader *mappedReader = format->createMemoryMappedReader(sampleSource);
+                if (mappedReader == nullptr) break;
+                mappedReaders.add(mappedReader);
+            }
+
+            if (mappedReaders.size() == SampleStream::numCacheBlocks)
+            {
+                storageMode = sMemoryMapped;
+                buildThumbnail(*audioReader, monitor);
+                stream = new SampleStream(mappedReaders, *streamThread);
+            }
+            else if (streamThread != nullptr)
+            {
+                storageMode = sStreamed;
+                buildThumbnail(*audioReader, monitor);
+                stream = new SampleStream(audioReader.release(), *streamThread);
+            }
+
+            DBG(sampleName << (storageMode == sMemoryMapped ? " is memory mapped" :
+                               storageMode == sStreamed ? " is streamed" : " is too long, but will be decoded anyway"));
+
+            if (storageMode != sInMemory) return;
+        }
+
+        data = new AudioSampleBuffer(numChannels, sampleLength);
+
+        // read in blocks so the loader can follow along (and cancel)
+        const int blockSize = 1 << 16;
+        for (int pos = 0; pos < sampleLength; pos += blockSize)
+        {
+            if (monitor != nullptr)
+            {
+                if (monitor->shouldCancelLoad())
+                    throw ("Loading cancelled: " + sampleName);
+
+                monitor->setLoadProgress(pos / (float) sampleLength);
+            }
+
+            audioReader->read(data, pos, jmin(blockSize, sampleLength - pos), pos, true, true);
+        }
 
         // Certain files would have a nasty click on the first/last sample,
         // so we zero that, just in case. UPDATE: this is still an issue!
@@ -51,7 +109,7 @@ AudioSample::AudioSample(const File &sampleSource,
         data->applyGain(sampleLength - 1, 1, 0.0f);
 
 
-        generateThumbnail(thumbnailLength);
+        buildThumbnail(thumbnailBuilder);
     }
     else
     {
@@ -65,7 +123,6 @@ AudioSample::AudioSample(const File &sampleSource,
 // preallocate space for a recording / resampling type sample
 AudioSample::AudioSample(const double &sampleRate,
                          const int &initialSamplelength,
-                         const int &thumbnailLength,
                          const String &name,
                          const int &newSampleType) :
     // Files //////////////////////////////////////////////
@@ -77,116 +134,236 @@ AudioSample::AudioSample(const double &sampleRate,
     data(new AudioSampleBuffer(numChannels, sampleLength)),
     sampleSampleRate(sampleRate), sampleType(newSampleType),
 
+    // Storage (for long files) ///////////////
+    storageMode(sInMemory), stream(),
+
     // Thumbnails ///////////////////////////
-    thumbnailData(), thumbnailFinished(false)
+    thumbnail(), thumbnailLock()
 {
     // this shouldn't happen
     jassert(sampleLength > 0);
     data->clear();
     // this is just a flat line (for empty sample)
-    generateThumbnail(thumbnailLength);
+    buildThumbnail();
 }
 
 AudioSample::~AudioSample()
 {
-    thumbnailData.clear(true);
 }
 
 
-void AudioSample::generateThumbnail(const int &thumbnailLength)
+void AudioSample::audioDataChanged()
 {
     // these may have changed so check!
     numChannels = data->getNumChannels();
     sampleLength = data->getNumSamples();
-    // make sure we start from scratch
-    thumbnailData.clear(true);
+}
 
-    // we don't want to be painting during this period
-    thumbnailFinished = false;
+void AudioSample::swapAudioData(ScopedPointer<AudioSampleBuffer> &newData, const double &newSampleRate)
+{
+    // only recordings can be swapped like this
+    jassert(storageMode == sInMemory && newData != nullptr);
 
-    float maxVal = 0.0f, minVal = 0.0f;
-    int samplesPerPixel = sampleLength / thumbnailLength;
-    Array<float> tempArray;
+    data.swapWith(newData);
+    sampleSampleRate = newSampleRate;
+    audioDataChanged();
+}
 
-    for (int c = 0; c < numChannels; ++c)
-    {
-        float * samplePointer = data->getSampleData(c);
+void AudioSample::buildThumbnail(ThumbnailBuilder *builder)
+{
+    ScopedPointer<PeakPyramid> newThumbnail(new PeakPyramid(numChannels, sampleLength));
 
-        tempArray.clear();
+    if (builder != nullptr)
+        builder->fillPyramid(*this, *newThumbnail);
+    else
+        fillThumbnail(*newThumbnail, 0, sampleLength);
 
-        for (int i = 0; i < sampleLength; ++i)
-        {
-            if (*samplePointer > maxVal)
-                maxVal = *samplePointer;
-            else if (*samplePointer < minVal)
-                minVal = *samplePointer;
+    newThumbnail->buildLevels();
+    setThumbnail(newThumbnail);
 
-            if (i % samplesPerPixel == 0)
-            {
-                // store the max and min values sequentially
-                tempArray.add(maxVal);
-                tempArray.add(minVal);
+    DBG("Thumbnail generated for sample: " << sampleName);
+}
 
-                //DBG(maxVal << " " << minVal);
-                minVal = maxVal = 0.0f;
-            }
+void AudioSample::buildThumbnail(AudioFormatReader &reader, LoadMonitor *monitor)
+{
+    ScopedPointer<PeakPyramid> newThumbnail(new PeakPyramid(numChannels, sampleLength));
+
+    // (a multiple of framesPerPeak)
+    const int blockSize = 1 << 16;
+    AudioSampleBuffer block(numChannels, blockSize);
 
-            ++samplePointer;
+    for (int pos = 0; pos < sampleLength; pos += blockSize)
+    {
+        // (this can take a while for compressed files)
+        if (monitor != nullptr)
+        {
+            if (monitor->shouldCancelLoad())
+                throw ("Loading cancelled: " + sampleName);
+
+            monitor->setLoadProgress(pos / (float) sampleLength);
         }
 
-        // and store this channel's thumbnail
-        thumbnailData.add(new Array<float>(tempArray));
+        const int numThisTime = jmin(blockSize, sampleLength - pos);
+        reader.read(&block, 0, numThisTime, pos, true, true);
+        newThumbnail->addFrames(block.getArrayOfChannels(), pos, numThisTime);
     }
 
-    thumbnailFinished = true;
+    newThumbnail->buildLevels();
+    setThumbnail(newThumbnail);
 
     DBG("Thumbnail generated for sample: " << sampleName);
 }
 
+void AudioSample::fillThumbnail(PeakPyramid &pyramid, const int &startFrame, const int &numFrames) const
+{
+    jassert(pyramid.getNumChannels() == numChannels);
+
+    if (data != nullptr)
+    {
+        const float* channels[2] = { data->getSampleData(0, startFrame),
+                                     numChannels > 1 ? data->getSampleData(1, startFrame) : nullptr };
+        pyramid.addFrames(channels, startFrame, numFrames);
+        return;
+    }
+
+    // samples that aren't in memory only have their thumbnail made when loading
+    jassertfalse;
+}
+
+void AudioSample::setThumbnail(ScopedPointer<PeakPyramid> &newThumbnail)
+{
+    {
+        const ScopedLock sl(thumbnailLock);
+        thumbnail.swapWith(newThumbnail);
+    }
+
+    // (the old one is deleted outside the lock)
+    newThumbnail = nullptr;
+}
+
+int64 AudioSample::getMemoryUsage() const
+{
+    switch (storageMode)
+    {
+    case sInMemory :
+        return (data != nullptr) ? (int64) data->getNumChannels() * data->getNumSamples() * (int64) sizeof(float) : 0;
+    case sStreamed :
+        return (int64) SampleStream::numCacheBlocks * SampleStream::blockSize * 2 * (int64) sizeof(float);
+    default :
+        return 0;
+    }
+}
+
+int64 AudioSample::estimateMemoryUsage(const File &sampleFile)
+{
+    AudioFormatManager manager;
+    manager.registerBasicFormats();
+
+    // this only reads the header
+    ScopedPointer<AudioFormatReader> reader(manager.createReaderFor(sampleFile));
+    if (reader == nullptr) return -1;
+
+    const int64 decodedSize = reader->lengthInSamples * jmin(2, (int) reader->numChannels) * (int64) sizeof(float);
+
+    // (long files are mapped or streamed, so allow for a stream)
+    if (decodedSize > maxInMemoryBytes)
+        return (int64) SampleStream::numCacheBlocks * SampleStream::blockSize * 2 * (int64) sizeof(float);
+
+    return decodedSize;
+}
+
+void AudioSample::readFrames(float *destL, float *destR,
+                             const int &startFrame, const int &numFrames) const
+{
+    jassert(startFrame >= 0 && startFrame + numFrames <= sampleLength);
+
+    if (stream != nullptr)
+    {
+        stream->readFrames(destL, destR, startFrame, numFrames);
+    }
+    else
+    {
+        // in memory samples should be read directly
+        jassertfalse;
+        zeromem(destL, sizeof(float) * (size_t) numFrames);
+        if (destR != nullptr) zeromem(destR, sizeof(float) * (size_t) numFrames);
+        return;
+    }
+
+    // like loaded samples, zero the first/last sample to avoid clicks
+    if (startFrame == 0)
+    {
+        destL[0] = 0.0f;
+        if (destR != nullptr) destR[0] = 0.0f;
+    }
+    if (startFrame + numFrames == sampleLength)
+    {
+        destL[numFrames - 1] = 0.0f;
+        if (destR != nullptr) destR[numFrames - 1] = 0.0f;
+    }
+}
+
+void AudioSample::setPlaybackPosition(const int &stripID, const int &position, const bool &isReversed) const
+{
+    if (stream != nullptr)
+        stream->setPlaybackPosition(stripID, position, isReversed);
+}
+
+void AudioSample::setChunkStarts(const int &stripID, const int &firstChunkStart,
+                                 const int &chunkSize, const int &numChunks) const
+{
+    if (stream != nullptr)
+        stream->setChunkStarts(stripID, firstChunkStart, chunkSize, numChunks);
+}
+
 void AudioSample::drawChannels(Graphics& g, const Rectangle<int>& area,
-                               float verticalZoomFactor) const
+                               float verticalZoomFactor,
+                               const int &startFrame, const int &endFrame) const
 {
-    if (thumbnailFinished)
+    const ScopedLock sl(thumbnailLock);
+
+    if (thumbnail != nullptr)
     {
-        for (int i = 0; i < numChannels; ++i)
+        const int numThumbnailChannels = thumbnail->getNumChannels();
+
+        for (int i = 0; i < numThumbnailChannels; ++i)
         {
-            const int y1 = roundToInt ((i * area.getHeight()) / numChannels);
-            const int y2 = roundToInt (((i + 1) * area.getHeight()) / numChannels);
+            const int y1 = roundToInt ((i * area.getHeight()) / numThumbnailChannels);
+            const int y2 = roundToInt (((i + 1) * area.getHeight()) / numThumbnailChannels);
 
             drawChannel (g, Rectangle<int> (area.getX(), area.getY() + y1, area.getWidth(), y2 - y1),
-                i, verticalZoomFactor);
+                i, verticalZoomFactor, startFrame, endFrame);
         }
     }
 }
 
 void AudioSample::drawChannel(Graphics& g, const Rectangle<int>& area,
-                              const int &channel, float verticalZoomFactor) const
+                              const int &channel, float verticalZoomFactor,
+                              const int &startFrame, const int &endFrame) const
 {
+    const ScopedLock sl(thumbnailLock);
+
+    const int width = area.getWidth();
+    if (thumbnail == nullptr || channel >= thumbnail->getNumChannels() || width <= 0)
+        return;
 
     const float topY = (float) area.getY();
     const float bottomY = (float) area.getBottom();
     const float midY = (topY + bottomY) * 0.5f;
     const float vscale = verticalZoomFactor * (bottomY - topY) * 0.7f;
 
-    if (thumbnailData[channel])
-    {
-        float *waveform = thumbnailData[channel]->getRawDataPointer();
+    // the pyramid means this never has to look at the audio itself
+    const int lastFrame = (endFrame < 0) ? thumbnail->getNumFrames() : endFrame;
+    HeapBlock<float> mins(width), maxs(width);
+    thumbnail->getPeaks(channel, startFrame, lastFrame, mins, maxs, width);
 
-        // check we have a valid pointer!
-        if (waveform)
-        {
-            float waveTop, waveBottom;
-
-            for (int i = 0; i < thumbnailData[channel]->size() / 2; ++i)
-            {
-                // max and min fill alternating entries in the thumbnailData structure
-                // additional factors of 0.5 are so zero samples are drawn as flat line
-                waveTop = midY - *(waveform++) * vscale - 0.5f;
-                waveBottom = midY - *(waveform++) * vscale + 0.5f;
+    for (int i = 0; i < width; ++i)
+    {
+        // additional factors of 0.5 are so zero samples are drawn as flat line
+        const float waveTop = midY - maxs[i] * vscale - 0.5f;
+        const float waveBottom = midY - mins[i] * vscale + 0.5f;
 
-                g.drawVerticalLine (i, jmax(waveTop, topY), jmin(waveBottom, bottomY));
-            }
-        }
+        g.drawVerticalLine (area.getX() + i, jmax(waveTop, topY), jmin(waveBottom, bottomY));
     }
 }
 
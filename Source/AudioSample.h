@@ -11,21 +11,41 @@
 #ifndef __AUDIOSAMPLE_H_DED61AB8__
 #define __AUDIOSAMPLE_H_DED61AB8__
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
+#include "SampleStream.h"
+#include "PeakPyramid.h"
+
+// forward declaration
+class ThumbnailBuilder;
 
 
 class AudioSample
 {
 public:
 
-    // create sample by loading file from disk
+    // Lets whoever is loading a sample follow its progress
+    // and cancel it (see SampleLoader)
+    class LoadMonitor
+    {
+    public:
+        virtual ~LoadMonitor() {}
+        // progress is from 0 to 1
+        virtual void setLoadProgress(const float &progress) = 0;
+        // returning true makes the constructor throw
+        virtual bool shouldCancelLoad() = 0;
+    };
+
+    // create sample by loading file from disk (long files will
+    // only be streamed if a thread to stream them with is given,
+    // and the thumbnail is shared over the builder's threads)
     AudioSample(const File &fileSampleSource,
-                const int &thumbnailLength);
+                ThumbnailBuilder *thumbnailBuilder,
+                LoadMonitor *monitor = nullptr,
+                TimeSliceThread *streamThread = nullptr);
 
     // preallocate space for a recording / resampling type sample
     AudioSample(const double &sampleRate,
                 const int &length,
-                const int &thumbnailLength,
                 const String &name,
                 const int &newSampleType);
 
@@ -42,31 +62,92 @@ public:
 
     int getSampleType() const { return sampleType; }
 
+    // Where the audio lives. Files that would take more than
+    // maxInMemoryBytes to decode are left on disk and streamed (see
+    // SampleStream): uncompressed ones (.wav / .aiff) a memory mapped
+    // block at a time and anything else decoded a block at a time.
+    // Recordings are always in memory.
+    enum StorageMode
+    {
+        sInMemory,
+        sMemoryMapped,
+        sStreamed
+    };
+
+    enum { maxInMemoryBytes = 64 * 1024 * 1024 };
+
+    int getStorageMode() const { return storageMode; }
+    bool isInMemory() const { return storageMode == sInMemory; }
+
+    // roughly how much memory the audio takes up (in bytes), mapped
+    // files don't count as the OS can page them out when it likes
+    int64 getMemoryUsage() const;
+    // what getMemoryUsage would be if this file was loaded (-1 if it can't be)
+    static int64 estimateMemoryUsage(const File &sampleFile);
+
+    // NOTE: this is null unless the sample is in memory
     AudioSampleBuffer* getAudioData() const { return data; }
 
+    /* For samples that aren't in memory, reads frames as floats (destR
+       can be null). This is safe to use from the audio thread, any part
+       of a streamed sample which hasn't been decoded yet is silent.
+    */
+    void readFrames(float *destL, float *destR, const int &startFrame, const int &numFrames) const;
+
+    // lets a streamed sample know where a strip is so it can read ahead...
+    void setPlaybackPosition(const int &stripID, const int &position, const bool &isReversed) const;
+    // ...and where it could jump to
+    void setChunkStarts(const int &stripID, const int &firstChunkStart,
+                        const int &chunkSize, const int &numChunks) const;
+
     int getSampleLength() const { return sampleLength; }
     float getSampleLengthSeconds() const { return (float) (sampleLength / sampleSampleRate); }
     int getNumChannels() const { return numChannels; }
     String getSampleName() const { return sampleName; }
     File getSampleFile() const { return sampleFile; }
     double getSampleRate() const { return sampleSampleRate; }
+    // recordings are made at whatever rate the host is running at
+    void setSampleRate(const double &newSampleRate) { sampleSampleRate = newSampleRate; }
 
-    // painting stuff
+    // painting stuff (endFrame = -1 means the end of the sample)
     void drawChannels (Graphics& g,
                        const Rectangle<int>& area,
-                       float verticalZoomFactor) const;
+                       float verticalZoomFactor,
+                       const int &startFrame = 0, const int &endFrame = -1) const;
     void drawChannel (Graphics& g,
                       const Rectangle<int>& area,
                       const int &channel,
-                      float verticalZoomFactor) const;
+                      float verticalZoomFactor,
+                      const int &startFrame = 0, const int &endFrame = -1) const;
+
+    // Call this after changing the contents of getAudioData() (e.g. a new
+    // recording) so the length is updated. The thumbnail should then be
+    // rebuilt, usually by passing the sample to a ThumbnailBuilder.
+    void audioDataChanged();
+
+    /* Swaps in a whole new take (recorded at newSampleRate), giving the
+       old buffer back through newData. This doesn't allocate so can be
+       used on the audio thread between blocks (see SampleCapture).
+    */
+    void swapAudioData(ScopedPointer<AudioSampleBuffer> &newData, const double &newSampleRate);
 
-    // allows the thumbnail to be refreshed externally
-    void generateThumbnail(const int &thumbnailLength);
+    /* Rebuilds the thumbnail, sharing the work between the builder's
+       threads if one is given. The new thumbnail is swapped in when it's
+       finished so the sample can be drawn at the same time.
+    */
+    void buildThumbnail(ThumbnailBuilder *builder = nullptr);
+
+    // adds this part of the sample to the thumbnail (see ThumbnailBuilder)
+    void fillThumbnail(PeakPyramid &pyramid, const int &startFrame, const int &numFrames) const;
 
     // override comparison operator ==
     bool operator== (const AudioSample &s1) const;
 private:
 
+    // makes the thumbnail straight from the file (for streamed / mapped samples)
+    void buildThumbnail(AudioFormatReader &reader, LoadMonitor *monitor);
+    void setThumbnail(ScopedPointer<PeakPyramid> &newThumbnail);
+
     // Files ////////////////////////////////////////
     // this stores the File object so we can retrieve
     // metadata (path, comments etc)
@@ -83,11 +164,16 @@ private:
     const int sampleType;
 
 
+    // Storage (for long files) ///////////////
+    int storageMode;
+    ScopedPointer<SampleStream> stream;
+
+
     // Thumbnails ///////////////////////////
-    // low res thumbnail version of the sample
-    OwnedArray< Array<float> > thumbnailData;
-    // has the thumbnail finished generating
-    bool thumbnailFinished;
+    // peaks of the sample at several resolutions
+    ScopedPointer<PeakPyramid> thumbnail;
+    // held while the thumbnail is drawn / replaced
+    CriticalSection thumbnailLock;
 
     // DEBUG: check for leaks
     JUCE_LEAK_DETECTOR(AudioSample);
@@ -0,0 +1,106 @@
+/*
+  ==============================================================================
+
+    CaptureHistory.cpp
+    Created: 19 Oct 2026 12:58:12am
+    Author:  hemmer
+
+  ==============================================================================
+*/
+
+#include "CaptureHistory.h"
+
+CaptureHistory::CaptureHistory() :
+    ringLock(), readLock(), ring(2, 0), ringSampleRate(0.0), ringMaxReadLength(0),
+    writePosition(0), numWritten(0)
+{
+}
+
+CaptureHistory::~CaptureHistory()
+{
+}
+
+void CaptureHistory::prepare(const double &sampleRate, const int &maxReadLength)
+{
+    if (sampleRate <= 0.0 || maxReadLength <= 0) return;
+
+    const int currentMaxReadLength = ringMaxReadLength.get();
+    if (sampleRate == ringSampleRate && maxReadLength <= currentMaxReadLength
+        && maxReadLength > currentMaxReadLength / 2)
+        return;
+
+    const ScopedLock readSl(readLock);
+    const ScopedLock ringSl(ringLock);
+
+    // (a bit extra so the tempo can slow down a little)
+    const int newMaxReadLength = maxReadLength + maxReadLength / 4;
+
+    ring.setSize(2, newMaxReadLength + (int) (sampleRate * spareSeconds));
+    ring.clear();
+    ringSampleRate = sampleRate;
+    ringMaxReadLength = newMaxReadLength;
+    writePosition = 0;
+    numWritten = 0;
+}
+
+void CaptureHistory::write(const AudioSampleBuffer &input, const int &numSamples)
+{
+    const ScopedTryLock sl(ringLock);
+    if (!sl.isLocked() || ring.getNumSamples() == 0) return;
+
+    const int ringLength = ring.getNumSamples();
+    int position = writePosition.get();
+    int numDone = 0;
+
+    // (this may wrap around the end of the ring)
+    while (numDone < numSamples)
+    {
+        const int numThisTime = jmin(numSamples - numDone, ringLength - position);
+        ring.copyFrom(0, position, input, 0, numDone, numThisTime);
+        ring.copyFrom(1, position, input, 1, numDone, numThisTime);
+
+        numDone += numThisTime;
+        position = (position + numThisTime) % ringLength;
+    }
+
+    writePosition = position;
+    numWritten += numSamples;
+}
+
+bool CaptureHistory::readLatest(AudioSampleBuffer &dest, const int &numSamples) const
+{
+    jassert(dest.getNumChannels() >= 2 && dest.getNumSamples() >= numSamples);
+
+    const ScopedLock sl(readLock);
+
+    if (numSamples <= 0 || numSamples > getMaxReadLength())
+        return false;
+
+    // Take where the audio thread was (it will carry on
+    // writing after this, but it's a long way behind us).
+    const int64 numWrittenBefore = numWritten.get();
+    if (numWrittenBefore < numSamples) return false;
+
+    const int ringLength = ring.getNumSamples();
+    int position = (writePosition.get() - numSamples + ringLength) % ringLength;
+    int numDone = 0;
+
+    while (numDone < numSamples)
+    {
+        const int numThisTime = jmin(numSamples - numDone, ringLength - position);
+        dest.copyFrom(0, numDone, ring, 0, position, numThisTime);
+        dest.copyFrom(1, numDone, ring, 1, position, numThisTime);
+
+        numDone += numThisTime;
+        position = (position + numThisTime) % ringLength;
+    }
+
+    // if the audio thread has gone all the way round to
+    // where we started then what we have is (partly) junk
+    return numWritten.get() - numWrittenBefore <= (int64) (ringLength - numSamples);
+}
+
+int CaptureHistory::getMaxReadLength() const
+{
+    return ringMaxReadLength.get();
+}
@@ -0,0 +1,71 @@
+/*
+  ==============================================================================
+
+    CaptureHistory.h
+    Created: 19 Oct 2026 12:58:12am
+    Author:  hemmer
+
+    Always keeps the last take's worth of audio (of the inputs or of
+    mlrVST's output) in a ring buffer, so that something good which
+    has already happened can still be kept: the latest part is copied
+    out into a record / resample slot (see SampleCapture::startFromHistory)
+    without having to wait through a precount and take.
+
+  ==============================================================================
+*/
+
+#ifndef CAPTUREHISTORY_H_INCLUDED
+#define CAPTUREHISTORY_H_INCLUDED
+
+#include "JuceHeader.h"
+
+
+class CaptureHistory
+{
+public:
+    CaptureHistory();
+    ~CaptureHistory();
+
+    // kept on top of the history so the audio thread doesn't catch up with a copy
+    enum { spareSeconds = 4 };
+
+    /* Makes room for (at least) maxReadLength samples of history at this
+       sample rate, forgetting what was there if the ring has to change.
+       The ring isn't shrunk for small changes (e.g. the tempo drifting).
+       Never call this from the audio thread.
+    */
+    void prepare(const double &sampleRate, const int &maxReadLength);
+
+    // (audio thread) adds the first two channels of the block to the history
+    void write(const AudioSampleBuffer &input, const int &numSamples);
+
+    /* Copies the last numSamples that were written into the start of dest.
+       Returns false if there isn't that much history (or the audio thread
+       overwrote it while we were copying). Never call this from the audio
+       thread.
+    */
+    bool readLatest(AudioSampleBuffer &dest, const int &numSamples) const;
+
+    // the longest amount readLatest can get
+    int getMaxReadLength() const;
+
+private:
+
+    // NOTE: the audio thread only ever tries this lock, so the
+    // history has a gap rather than the audio thread waiting
+    CriticalSection ringLock;
+    // stops the ring being resized while it's being read
+    CriticalSection readLock;
+
+    AudioSampleBuffer ring;
+    double ringSampleRate;
+    Atomic<int> ringMaxReadLength;
+
+    Atomic<int> writePosition;
+    Atomic<int64> numWritten;   // in total (so we can tell if it's been overwritten)
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CaptureHistory);
+};
+
+
+#endif  // CAPTUREHISTORY_H_INCLUDED
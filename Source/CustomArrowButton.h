@@ -2,7 +2,7 @@
 #define __CUSTOMARROWBUTTON__
 
 #include "CustomArrowButton.h"
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 
 class CustomArrowButton  : public Button
 {
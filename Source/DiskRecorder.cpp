@@ -0,0 +1,194 @@
+/*
+  ==============================================================================
+
+    DiskRecorder.cpp
+    Created: 19 Oct 2026 12:21:44am
+    Author:  hemmer
+
+  ==============================================================================
+*/
+
+#include "DiskRecorder.h"
+
+DiskRecorder::DiskRecorder(TimeSliceThread &writerThread) :
+    thread(writerThread), finishLock(), writersToFinish(), filesToFinish(), finishedFiles(),
+    writerLock(), threadedWriter(), currentFile(), currentSampleRate(44100.0),
+    recording(0), numSamplesRecorded(0), numDroppedBlocks(0)
+{
+    thread.addTimeSliceClient(this);
+}
+
+DiskRecorder::~DiskRecorder()
+{
+    // (this waits if the thread is using us)
+    thread.removeTimeSliceClient(this);
+
+    // make sure whatever we have makes it to disk
+    stop();
+
+    const ScopedLock sl(finishLock);
+    writersToFinish.clear(true);
+}
+
+bool DiskRecorder::start(const File &fileToRecordTo, const int &fileFormat, const double &sampleRate)
+{
+    stop();
+
+    ScopedPointer<AudioFormat> format;
+    if (fileFormat == formatWav) format = new WavAudioFormat();
+    else if (fileFormat == formatFlac) format = new FlacAudioFormat();
+    else return false;
+
+    if (sampleRate <= 0.0 || ! fileToRecordTo.getParentDirectory().createDirectory())
+        return false;
+
+    fileToRecordTo.deleteFile();
+    ScopedPointer<FileOutputStream> outStream(fileToRecordTo.createOutputStream());
+
+    if (outStream == nullptr)
+    {
+        DBG("Couldn't create " << fileToRecordTo.getFullPathName());
+        return false;
+    }
+
+    AudioFormatWriter *writer = format->createWriterFor(outStream, sampleRate, 2, 24,
+                                                        StringPairArray(), 0);
+    if (writer == nullptr)
+    {
+        outStream = nullptr;
+        fileToRecordTo.deleteFile();
+        DBG("Couldn't create a writer for " << fileToRecordTo.getFullPathName());
+        return false;
+    }
+
+    // the writer owns the stream now
+    outStream.release();
+
+    const int fifoLength = (int) (sampleRate * fifoLengthSeconds);
+    ScopedPointer<AudioFormatWriter::ThreadedWriter> newWriter(
+        new AudioFormatWriter::ThreadedWriter(writer, thread, fifoLength));
+
+    currentFile = fileToRecordTo;
+    currentSampleRate = sampleRate;
+    numSamplesRecorded = 0;
+    numDroppedBlocks = 0;
+
+    {
+        const ScopedLock sl(writerLock);
+        threadedWriter = newWriter.release();
+        recording = 1;
+    }
+
+    DBG("Recording to " << currentFile.getFullPathName());
+    return true;
+}
+
+File DiskRecorder::stop()
+{
+    ScopedPointer<AudioFormatWriter::ThreadedWriter> oldWriter;
+
+    {
+        const ScopedLock sl(writerLock);
+        if (threadedWriter == nullptr) return File::nonexistent;
+
+        recording = 0;
+        oldWriter = threadedWriter.release();
+    }
+
+    // deleting the writer flushes the FIFO and finishes the file (we
+    // do this outside the lock so the audio thread isn't kept out)
+    oldWriter = nullptr;
+
+    if (numDroppedBlocks.get() > 0)
+    {
+        DBG(numDroppedBlocks.get() << " blocks were dropped recording " << currentFile.getFileName());
+    }
+
+    return currentFile;
+}
+
+void DiskRecorder::stopInBackground()
+{
+    ScopedPointer<AudioFormatWriter::ThreadedWriter> oldWriter;
+
+    {
+        const ScopedLock sl(writerLock);
+        if (threadedWriter == nullptr) return;
+
+        recording = 0;
+        oldWriter = threadedWriter.release();
+    }
+
+    if (numDroppedBlocks.get() > 0)
+    {
+        DBG(numDroppedBlocks.get() << " blocks were dropped recording " << currentFile.getFileName());
+    }
+
+    {
+        const ScopedLock sl(finishLock);
+        writersToFinish.add(oldWriter.release());
+        filesToFinish.add(currentFile);
+    }
+
+    thread.moveToFrontOfQueue(this);
+}
+
+File DiskRecorder::getNextFinishedFile()
+{
+    const ScopedLock sl(finishLock);
+
+    if (finishedFiles.size() == 0)
+        return File::nonexistent;
+
+    return finishedFiles.remove(0);
+}
+
+int DiskRecorder::useTimeSlice()
+{
+    ScopedPointer<AudioFormatWriter::ThreadedWriter> oldWriter;
+    File oldFile;
+
+    {
+        const ScopedLock sl(finishLock);
+        if (writersToFinish.size() == 0) return 500;
+
+        oldWriter = writersToFinish.removeAndReturn(0);
+        oldFile = filesToFinish.remove(0);
+    }
+
+    // deleting the writer flushes the FIFO and finishes the file
+    // (outside the lock, as this can take a while)
+    oldWriter = nullptr;
+
+    const ScopedLock sl(finishLock);
+    finishedFiles.add(oldFile);
+
+    // (there may be more to finish)
+    return 0;
+}
+
+void DiskRecorder::write(const AudioSampleBuffer &input, const int &numSamples)
+{
+    if (! isRecording()) return;
+
+    // if start / stop have got the lock we just skip this block
+    const ScopedTryLock sl(writerLock);
+
+    if (sl.isLocked() && threadedWriter != nullptr)
+    {
+        if (threadedWriter->write((const float**) input.getArrayOfChannels(), numSamples))
+            numSamplesRecorded += numSamples;
+        else
+            ++numDroppedBlocks;
+    }
+}
+
+double DiskRecorder::getSecondsRecorded() const
+{
+    return numSamplesRecorded.get() / currentSampleRate;
+}
+
+String DiskRecorder::getFileExtension(const int &fileFormat)
+{
+    return (fileFormat == formatFlac) ? ".flac" : ".wav";
+}
@@ -0,0 +1,107 @@
+/*
+  ==============================================================================
+
+    DiskRecorder.h
+    Created: 19 Oct 2026 12:21:44am
+    Author:  hemmer
+
+    Records straight to a WAV / FLAC file rather than into memory, so a
+    take can be as long as you like (e.g. a whole set). The audio thread
+    only copies each block into a FIFO, and a background thread encodes
+    it to disk. Stopping finishes the file (on that same thread, as it has
+    to flush the FIFO), which can then be loaded into the sample pool like
+    any other (long files are streamed back from disk rather than loaded,
+    see AudioSample).
+
+  ==============================================================================
+*/
+
+#ifndef DISKRECORDER_H_INCLUDED
+#define DISKRECORDER_H_INCLUDED
+
+#include "JuceHeader.h"
+
+
+class DiskRecorder : public TimeSliceClient
+{
+public:
+    DiskRecorder(TimeSliceThread &writerThread);
+    ~DiskRecorder();
+
+    enum FileFormat
+    {
+        formatNone,     // (record into memory instead)
+        formatWav,
+        formatFlac
+    };
+
+    enum { fifoLengthSeconds = 4 };  // how far the disk can fall behind
+
+    /* Creates the file and starts recording into it. Returns false (and
+       leaves nothing behind) if the file couldn't be made. Never call
+       this from the audio thread.
+    */
+    bool start(const File &fileToRecordTo, const int &fileFormat, const double &sampleRate);
+
+    /* Stops recording, finishing off the file. Returns the file that was
+       recorded (File::nonexistent if we weren't). This blocks until the
+       file is finished, so never call it from the audio thread (or where
+       a press is being handled, see stopInBackground).
+    */
+    File stop();
+
+    /* Stops recording straight away but leaves the writer thread to
+       finish off the file, which then turns up in getNextFinishedFile().
+       Never call this from the audio thread.
+    */
+    void stopInBackground();
+
+    /* Returns the next recording that stopInBackground() has finished
+       (File::nonexistent if there are none), each one only once.
+    */
+    File getNextFinishedFile();
+
+    /* (audio thread) Adds the first two channels of the input to the
+       recording. This never waits: if the disk can't keep up the block
+       is dropped (see getNumDroppedBlocks).
+    */
+    void write(const AudioSampleBuffer &input, const int &numSamples);
+
+    bool isRecording() const { return recording.get() != 0; }
+
+    // where the current (or last) recording is going
+    File getFile() const { return currentFile; }
+    double getSecondsRecorded() const;
+    int getNumDroppedBlocks() const { return numDroppedBlocks.get(); }
+
+    // the extension for this format, including the dot
+    static String getFileExtension(const int &fileFormat);
+
+    // TimeSliceClient
+    int useTimeSlice();
+
+private:
+
+    TimeSliceThread &thread;
+
+    // recordings being finished off by the thread (see stopInBackground)
+    CriticalSection finishLock;
+    OwnedArray<AudioFormatWriter::ThreadedWriter> writersToFinish;
+    Array<File> filesToFinish, finishedFiles;
+
+    // NOTE: the audio thread only ever tries this lock
+    CriticalSection writerLock;
+    ScopedPointer<AudioFormatWriter::ThreadedWriter> threadedWriter;
+
+    File currentFile;
+    double currentSampleRate;
+
+    Atomic<int> recording;
+    Atomic<int64> numSamplesRecorded;
+    Atomic<int> numDroppedBlocks;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DiskRecorder);
+};
+
+
+#endif  // DISKRECORDER_H_INCLUDED
@@ -48,7 +48,7 @@
 // In order to enable this you will need a patch to Juce
 //#define TYPEFACE_BITMAP_RENDERING
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 #include "FreeTypeAmalgam.h"
 #include "FreeTypeFaces.h"
 
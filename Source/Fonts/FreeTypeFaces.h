@@ -33,7 +33,7 @@
 #ifndef VF_FREETYPEFACES_VFHEADER
 #define VF_FREETYPEFACES_VFHEADER
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 
 
 /*============================================================================*/
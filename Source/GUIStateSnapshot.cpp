@@ -0,0 +1,38 @@
+/*
+  ==============================================================================
+
+    GUIStateSnapshot.cpp
+    Created: 19 Oct 2026 6:52:17am
+    Author:  hemmer
+
+  ==============================================================================
+*/
+
+#include "GUIStateSnapshot.h"
+
+GUIStateSnapshot::GUIStateSnapshot() :
+    writeIndex(0), readIndex(1), middleIndex(2)
+{
+    zeromem(states, sizeof(states));
+}
+
+void GUIStateSnapshot::publish()
+{
+    ++states[writeIndex].blockNumber;
+    const uint32 blockNumber = states[writeIndex].blockNumber;
+
+    // swap ours for the middle one, which we then fill in next time
+    writeIndex = middleIndex.exchange(writeIndex | newStateFlag) & indexMask;
+
+    // (so the block numbers keep going up whichever copy we get)
+    states[writeIndex].blockNumber = blockNumber;
+}
+
+bool GUIStateSnapshot::update()
+{
+    if ((middleIndex.get() & newStateFlag) == 0)
+        return false;
+
+    readIndex = middleIndex.exchange(readIndex) & indexMask;
+    return true;
+}
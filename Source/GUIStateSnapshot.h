@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    GUIStateSnapshot.h
+    Created: 19 Oct 2026 6:52:17am
+    Author:  hemmer
+
+    Everything the GUI needs to draw from the audio thread (the strips'
+    playback positions, the patterns, recording progress and the tempo),
+    published once per block. There are three copies of the state: the
+    audio thread fills one in, the GUI reads another and the third is the
+    latest finished one, which the two swap with. So neither side ever
+    locks or waits, and the GUI always gets a consistent state however
+    many blocks it has missed.
+
+    Rather than sending change messages, strips and patterns count their
+    changes, so the GUI can tell which ones it needs to catch up with.
+
+  ==============================================================================
+*/
+
+#ifndef GUISTATESNAPSHOT_H_INCLUDED
+#define GUISTATESNAPSHOT_H_INCLUDED
+
+#include "JuceHeader.h"
+
+
+class GUIStateSnapshot
+{
+public:
+    GUIStateSnapshot();
+
+    enum { maxNumStrips = 64, maxNumPatterns = 16 };
+
+    struct StripState
+    {
+        bool isPlaying;
+        float playbackPercentage;
+        uint32 changeCount;         // goes up whenever a parameter changes
+    };
+
+    struct PatternState
+    {
+        bool isRecording, isPlaying;
+        float precountPercent, percent;
+        uint32 changeCount;         // goes up whenever the events change
+    };
+
+    struct State
+    {
+        uint32 blockNumber;
+
+        int numStrips;
+        StripState strips[maxNumStrips];
+
+        int numPatterns, currentPatternBank;
+        PatternState patterns[maxNumPatterns];
+
+        bool isRecording, isResampling;
+        float recordPrecountPercent, recordPercent;
+        float resamplePrecountPercent, resamplePercent;
+
+        double currentBPM;
+    };
+
+    /* (audio thread) The state to fill in for this block. All of it has
+       to be filled in, as it won't be the one from the last block.
+    */
+    State& getStateToWrite() { return states[writeIndex]; }
+    // (audio thread) hands the state just filled in to the GUI
+    void publish();
+
+    /* (GUI thread) Picks up the newest published state, if there is one
+       since the last call, and returns true if so.
+    */
+    bool update();
+    // (GUI thread) the state picked up by the last update()
+    const State& getState() const { return states[readIndex]; }
+
+private:
+
+    enum { indexMask = 3, newStateFlag = 4 };
+
+    State states[3];
+    int writeIndex, readIndex;
+    // the one in between (with newStateFlag set if the GUI hasn't had it)
+    Atomic<int> middleIndex;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GUIStateSnapshot);
+};
+
+
+#endif  // GUISTATESNAPSHOT_H_INCLUDED
@@ -17,6 +17,8 @@ GlobalSettings::GlobalSettings(mlrVSTAudioProcessor* owner) :
     // Misc /////////////////////////////////////////////////////////
     monomeSize(eightByEight), numMonomeRows(8), numMonomeCols(8),
     rampLength(50), numSampleStrips(7), monitorInputs(false),
+    numRenderThreads(1), sampleMemoryBudget(1024), diskRecordFormat(0),
+    ledFrameRate(30),
 
     // Tempo / Quantisation /////////////////////////////////////////
     quantisationLevel(-1.0), quantiseMenuSelection(1),
@@ -70,6 +72,10 @@ String GlobalSettings::getGlobalSettingName(const int &settingID)
     case sPatternLength : return "pattern_length";
     case sPatternBank : return "pattern_bank";
     case sOSCPrefix : return "osc_prefix";
+    case sNumRenderThreads : return "num_render_threads";
+    case sSampleMemoryBudget : return "sample_memory_budget";
+    case sDiskRecordFormat : return "disk_record_format";
+    case sLEDFrameRate : return "led_frame_rate";
     default : jassertfalse; return "name_not_found";
     }
 }
@@ -108,6 +114,10 @@ int GlobalSettings::getGlobalSettingType(const int &settingID)
     case sPatternPrecount : return TypeInt;
     case sPatternLength : return TypeInt;
     case sPatternBank : return TypeInt;
+    case sNumRenderThreads : return TypeInt;
+    case sSampleMemoryBudget : return TypeInt;
+    case sDiskRecordFormat : return TypeInt;
+    case sLEDFrameRate : return TypeInt;
     default : jassertfalse; return TypeError;
     }
 }
@@ -146,6 +156,10 @@ int GlobalSettings::getSettingPresetScope(const int &settingID)
     case sPatternLength : return ScopePreset;
     case sPatternBank : return ScopePreset;
     case sRampLength : return ScopeSetlist;
+    case sNumRenderThreads : return ScopeSetlist;
+    case sSampleMemoryBudget : return ScopeSetlist;
+    case sDiskRecordFormat : return ScopeSetlist;
+    case sLEDFrameRate : return ScopeSetlist;
     default : jassertfalse; return ScopeError;
     }
 }
@@ -226,14 +240,18 @@ void GlobalSettings::setGlobalSetting(const int &settingID,
         monitorInputs = *static_cast<const bool*>(newValue); break;
 
     case sResampleLength :
-        resampleLength = *static_cast<const int*>(newValue); break;
+        resampleLength = *static_cast<const int*>(newValue);
+        processor->reserveCaptureBuffers();
+        break;
     case sResamplePrecount :
         resamplePrecountLength = *static_cast<const int*>(newValue); break;
     case sResampleBank :
         resampleBank = *static_cast<const int*>(newValue); break;
 
     case sRecordLength :
-        recordLength = *static_cast<const int*>(newValue); break;
+        recordLength = *static_cast<const int*>(newValue);
+        processor->reserveCaptureBuffers();
+        break;
     case sRecordPrecount :
         recordPrecountLength = *static_cast<const int*>(newValue); break;
     case sRecordBank :
@@ -303,6 +321,32 @@ void GlobalSettings::setGlobalSetting(const int &settingID,
 
             break;
         }
+    case sNumRenderThreads :
+        {
+            numRenderThreads = jlimit(1, (int) StripRenderPool::maxNumThreads, *static_cast<const int*>(newValue));
+            processor->setNumRenderThreads(numRenderThreads);
+            break;
+        }
+    case sSampleMemoryBudget :
+        {
+            sampleMemoryBudget = jmax(0, *static_cast<const int*>(newValue));
+            // (a bigger budget might let more of the setlist in)
+            processor->prefetchSetlistSamples();
+            break;
+        }
+    case sDiskRecordFormat :
+        {
+            // (any recording in progress carries on until it's stopped)
+            diskRecordFormat = jlimit((int) DiskRecorder::formatNone, (int) DiskRecorder::formatFlac,
+                                      *static_cast<const int*>(newValue));
+            break;
+        }
+    case sLEDFrameRate :
+        {
+            ledFrameRate = jlimit(5, 60, *static_cast<const int*>(newValue));
+            processor->setLEDFrameRate(ledFrameRate);
+            break;
+        }
 
     default :
         jassertfalse;
@@ -378,6 +422,10 @@ const void* GlobalSettings::getGlobalSetting(const int &settingID) const
     case sPatternPrecount : return &currentPatternPrecountLength;
     case sPatternBank : return &currentPatternBank;
     case sRampLength : return &rampLength;
+    case sNumRenderThreads : return &numRenderThreads;
+    case sSampleMemoryBudget : return &sampleMemoryBudget;
+    case sDiskRecordFormat : return &diskRecordFormat;
+    case sLEDFrameRate : return &ledFrameRate;
     default : jassertfalse; return 0;
     }
 }
@@ -15,9 +15,11 @@
 #ifndef GLOBALSETTINGS_H_INCLUDED
 #define GLOBALSETTINGS_H_INCLUDED
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 #include "PluginProcessor.h"
 
+template <int settingID> struct GlobalSettingInfo;
+
 class GlobalSettings
 {
 public:
@@ -54,6 +56,10 @@ public:
         sPatternLength,
         sPatternBank,
         sRampLength,                // length of volume envelope (in samples)
+        sNumRenderThreads,          // threads used to render strips (1 = audio thread only)
+        sSampleMemoryBudget,        // how much the setlist can prefetch (in MB, 0 = none)
+        sDiskRecordFormat,          // record / resample straight to disk (see DiskRecorder)
+        sLEDFrameRate,              // how often the monome's LEDs are updated (per second)
         NumGlobalSettings
     };
 
@@ -106,6 +112,21 @@ public:
     const void* getGlobalSettingArray(const int &settingID, const int &index) const;
     const int getGlobalSettingArrayLength(const int &settingID) const;
 
+    // Typed versions for when the setting is known at compile time, e.g.
+    // getGlobalSetting<sNumMonomeCols>() returns the int itself, so reading
+    // it is just a load. Setting still goes through the switch above.
+    template <int settingID>
+    const typename GlobalSettingInfo<settingID>::Type& getGlobalSetting() const
+    {
+        return this->*GlobalSettingInfo<settingID>::member();
+    }
+    template <int settingID>
+    void setGlobalSetting(const typename GlobalSettingInfo<settingID>::Type &newValue,
+                          const bool &notifyListeners = true)
+    {
+        setGlobalSetting(settingID, GlobalSettingInfo<settingID>::toVoid(newValue), notifyListeners);
+    }
+
     enum MonomeSizes
     {
         eightByEight = 1, eightBySixteen, sixteenByEight, sixteenBySixteen, numSizes
@@ -127,6 +148,23 @@ public:
     int numSampleStrips;    // How many SampleStrips (roughly number of monome rows)
     bool monitorInputs;     // do we want to monitor incoming inputs?
 
+    // With lots of busy strips, the rendering can be shared between
+    // several threads. 1 means everything is done on the audio thread.
+    int numRenderThreads;
+
+    // Samples in the setlist are loaded in the background ahead of
+    // time (so switching presets is instant) until the sample pool
+    // uses this much memory (in MB).
+    int sampleMemoryBudget;
+
+    // Record / resample buttons can write to a file (of any length) in
+    // the recordings folder instead, as one of DiskRecorder::FileFormat.
+    int diskRecordFormat;
+
+    // How many times a second the monome's LEDs are updated (only
+    // what has changed is sent, as a single bundle each time).
+    int ledFrameRate;
+
 
     // Tempo / Quantisation ////////////////////////////////////////////
     // OSC messages from the monome are converted to MIDI messages.
@@ -184,6 +222,61 @@ private:
 };
 
 
+// Typed setting lookup //////////////////////////////////////////////////
+// Maps each setting to the member which stores it, along with its type.
+// The names / types used for presets are still in the switches above.
+#define MLR_GLOBAL_SETTING(settingID, SettingType, memberName) \
+    template <> struct GlobalSettingInfo<GlobalSettings::settingID> \
+    { \
+        typedef SettingType Type; \
+        typedef SettingType GlobalSettings::* MemberPtr; \
+        static MemberPtr member() { return &GlobalSettings::memberName; } \
+        static const void* toVoid(const Type &newValue) { return &newValue; } \
+    };
+
+// arrays are set an element at a time (see setGlobalSettingArray) so can only be read
+#define MLR_GLOBAL_SETTING_ARRAY(settingID, SettingType, memberName) \
+    template <> struct GlobalSettingInfo<GlobalSettings::settingID> \
+    { \
+        typedef SettingType Type; \
+        typedef SettingType GlobalSettings::* MemberPtr; \
+        static MemberPtr member() { return &GlobalSettings::memberName; } \
+    };
+
+MLR_GLOBAL_SETTING       (sUseExternalTempo,      bool,         useExternalTempo)
+MLR_GLOBAL_SETTING       (sPresetName,            String,       presetName)
+MLR_GLOBAL_SETTING       (sNumChannels,           int,          numChannels)
+MLR_GLOBAL_SETTING_ARRAY (sChannelGains,          Array<float>, channelGains)
+MLR_GLOBAL_SETTING_ARRAY (sChannelMutes,          Array<bool>,  channelMutes)
+MLR_GLOBAL_SETTING       (sMonomeSize,            int,          monomeSize)
+MLR_GLOBAL_SETTING       (sNumMonomeRows,         int,          numMonomeRows)
+MLR_GLOBAL_SETTING       (sNumMonomeCols,         int,          numMonomeCols)
+MLR_GLOBAL_SETTING       (sNumSampleStrips,       int,          numSampleStrips)
+MLR_GLOBAL_SETTING       (sMasterGain,            float,        masterGain)
+MLR_GLOBAL_SETTING       (sCurrentBPM,            double,       currentBPM)
+MLR_GLOBAL_SETTING       (sQuantiseLevel,         double,       quantisationLevel)
+MLR_GLOBAL_SETTING       (sQuantiseMenuSelection, int,          quantiseMenuSelection)
+MLR_GLOBAL_SETTING       (sOSCPrefix,             String,       OSCPrefix)
+MLR_GLOBAL_SETTING       (sMonitorInputs,         bool,         monitorInputs)
+MLR_GLOBAL_SETTING       (sRecordPrecount,        int,          recordPrecountLength)
+MLR_GLOBAL_SETTING       (sRecordLength,          int,          recordLength)
+MLR_GLOBAL_SETTING       (sRecordBank,            int,          recordBank)
+MLR_GLOBAL_SETTING       (sResamplePrecount,      int,          resamplePrecountLength)
+MLR_GLOBAL_SETTING       (sResampleLength,        int,          resampleLength)
+MLR_GLOBAL_SETTING       (sResampleBank,          int,          resampleBank)
+MLR_GLOBAL_SETTING       (sPatternPrecount,       int,          currentPatternPrecountLength)
+MLR_GLOBAL_SETTING       (sPatternLength,         int,          currentPatternLength)
+MLR_GLOBAL_SETTING       (sPatternBank,           int,          currentPatternBank)
+MLR_GLOBAL_SETTING       (sRampLength,            int,          rampLength)
+MLR_GLOBAL_SETTING       (sNumRenderThreads,      int,          numRenderThreads)
+MLR_GLOBAL_SETTING       (sSampleMemoryBudget,    int,          sampleMemoryBudget)
+MLR_GLOBAL_SETTING       (sDiskRecordFormat,      int,          diskRecordFormat)
+MLR_GLOBAL_SETTING       (sLEDFrameRate,          int,          ledFrameRate)
+
+#undef MLR_GLOBAL_SETTING
+#undef MLR_GLOBAL_SETTING_ARRAY
+
+
 
 
 
@@ -11,7 +11,7 @@
 #ifndef __HINTOVERLAY_H_
 #define __HINTOVERLAY_H_
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 
 class mlrVSTAudioProcessor;
 
@@ -0,0 +1,68 @@
+/*
+  ==============================================================================
+
+    LEDFramebuffer.cpp
+    Created: 19 Oct 2026 3:16:40am
+    Author:  hemmer
+
+  ==============================================================================
+*/
+
+#include "LEDFramebuffer.h"
+
+LEDFramebuffer::LEDFramebuffer()
+{
+    clear();
+}
+
+void LEDFramebuffer::setLED(const int &col, const int &row, const bool &state)
+{
+    if (row < 0 || row >= maxNumRows || col < 0 || col >= maxNumCols)
+        return;
+
+    const uint8 bit = (uint8) (1 << (col % blockSize));
+
+    if (state)
+        wanted[row][col / blockSize] |= bit;
+    else
+        wanted[row][col / blockSize] &= ~bit;
+}
+
+void LEDFramebuffer::setRow(const int &row, const bool &state)
+{
+    if (row < 0 || row >= maxNumRows)
+        return;
+
+    for (int b = 0; b < numBlocks; ++b)
+        wanted[row][b] = state ? 0xff : 0;
+}
+
+void LEDFramebuffer::clear()
+{
+    zeromem(wanted, sizeof(wanted));
+    zeromem(shown, sizeof(shown));
+    zeromem(isStale, sizeof(isStale));
+}
+
+void LEDFramebuffer::invalidate()
+{
+    // (every row is sent, whatever is drawn before the next frame)
+    for (int r = 0; r < maxNumRows; ++r)
+        for (int b = 0; b < numBlocks; ++b)
+            isStale[r][b] = true;
+}
+
+bool LEDFramebuffer::isDirty() const
+{
+    for (int r = 0; r < maxNumRows; ++r)
+        for (int b = 0; b < numBlocks; ++b)
+            if (isRowDirty(r, b)) return true;
+
+    return false;
+}
+
+void LEDFramebuffer::markShown()
+{
+    memcpy(shown, wanted, sizeof(wanted));
+    zeromem(isStale, sizeof(isStale));
+}
@@ -0,0 +1,65 @@
+/*
+  ==============================================================================
+
+    LEDFramebuffer.h
+    Created: 19 Oct 2026 3:16:40am
+    Author:  hemmer
+
+    A copy of what the monome's LEDs should be showing, along with what
+    we last sent to it. Drawing into this is cheap (nothing is sent), and
+    each frame only the rows which have actually changed are sent (see
+    OSCHandler::sendLEDFrame), so a strip that isn't doing anything costs
+    nothing.
+
+  ==============================================================================
+*/
+
+#ifndef LEDFRAMEBUFFER_H_INCLUDED
+#define LEDFRAMEBUFFER_H_INCLUDED
+
+#include "JuceHeader.h"
+
+
+class LEDFramebuffer
+{
+public:
+    LEDFramebuffer();
+
+    // Each row is stored as a bitmask per block of 8
+    // LEDs, which is what the row / frame messages use.
+    enum { maxNumRows = 16, maxNumCols = 16, blockSize = 8, numBlocks = maxNumCols / blockSize };
+
+    void setLED(const int &col, const int &row, const bool &state);
+    void setRow(const int &row, const bool &state);
+    // turns everything off (call this when the device has been cleared)
+    void clear();
+    // sends everything on the next frame (e.g. if the device has changed)
+    void invalidate();
+
+    bool isDirty() const;
+    bool isRowDirty(const int &row, const int &block) const
+    { return isStale[row][block] || wanted[row][block] != shown[row][block]; }
+    uint8 getRowMask(const int &row, const int &block) const
+    { return wanted[row][block]; }
+
+    // call once the changes have been sent (all of them, or just one
+    // block of a row, if only some of the messages could be queued)
+    void markShown();
+    void markShown(const int &row, const int &block)
+    {
+        shown[row][block] = wanted[row][block];
+        isStale[row][block] = false;
+    }
+
+private:
+
+    uint8 wanted[maxNumRows][numBlocks];
+    uint8 shown[maxNumRows][numBlocks];
+    // set when we don't know what the device is showing (see invalidate)
+    bool isStale[maxNumRows][numBlocks];
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LEDFramebuffer);
+};
+
+
+#endif  // LEDFRAMEBUFFER_H_INCLUDED
@@ -46,6 +46,8 @@ const String MappingEngine::getTopRowMappingName(const int &mappingID) const
     case tmStartResampling : return "stop recording";
     case tmStopAll : return "stop all strips";
     case tmTapeStopAll : return "tape stop all strips";
+    case tmKeepLastRecording : return "keep last recording";
+    case tmKeepLastResampling : return "keep last resampling";
     default : jassertfalse; return "error: mappingID " + String(mappingID) + " not found!";
     }
 }
@@ -20,7 +20,7 @@
 #ifndef __MAPPINGENGINE_H_326A1AC7__
 #define __MAPPINGENGINE_H_326A1AC7__
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 
 
 class MappingEngine
@@ -51,6 +51,9 @@ public:
         tmStartResampling,
         tmStopAll,
         tmTapeStopAll,
+        // keep what was just played (see CaptureHistory)
+        tmKeepLastRecording,
+        tmKeepLastResampling,
 
         tmNumTopRowMappings
     };
@@ -11,7 +11,7 @@
 #ifndef __MAPPINGPANEL_H_9FE09672__
 #define __MAPPINGPANEL_H_9FE09672__
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 #include "mlrVSTLookAndFeel.h"
 
 /* Forward declaration to set up pointer arrangement
@@ -17,15 +17,65 @@ OSCHandler::OSCHandler(const String &prefix, mlrVSTAudioProcessor * const owner)
     // incoming ///////////////////////////////////////
     parent(owner), incomingPort(8000),
     s(IpEndpointName("localhost", incomingPort), this),
-    // incoming ///////////////////////////////////////
-    buffer(), p(buffer, 1536),
-    transmitSocket(IpEndpointName("localhost", 8080)),
+    // outgoing ///////////////////////////////////////
+    sender("localhost", 8080),
     // strings ////////////////////////////
-    OSCPrefix(prefix), ledStr(OSCPrefix + "led"), ledRowStr(OSCPrefix + "led_row"),
-    ledClearStr(OSCPrefix + "clear"), buttonPressMask(OSCPrefix + "press")
+    OSCPrefix(prefix), pressAddress(), stripAddress(),
+    profileAddress(), profileResetAddress(), traceDumpAddress(), addressLock()
 {
     // setup the mask
     setPrefix(prefix);
+
+    sender.setTraceRecorder(&parent->getTraceRecorder());
+
+    sender.startThread(5);
+}
+
+const char* const OSCHandler::stripCommandNames[OSCHandler::numStripCommands] =
+{
+    "vol", "speed", "chan"
+};
+
+void OSCHandler::setPrefix(const String &prefix)
+{
+    OSCPrefix = "/" + prefix + "/";
+    sender.setPrefix(OSCPrefix);
+
+    {
+        const ScopedLock sl(addressLock);
+        pressAddress.set(OSCPrefix + "press");
+        stripAddress.set(OSCPrefix + "strip/");
+        profileAddress.set(OSCPrefix + "profile");
+        profileResetAddress.set(OSCPrefix + "profile/reset");
+        traceDumpAddress.set(OSCPrefix + "trace/dump");
+    }
+
+    DBG("prefix now: " << OSCPrefix);
+}
+
+void OSCHandler::Address::set(const String &address)
+{
+    length = (int) address.getNumBytesAsUTF8();
+    text.malloc(length + 1);
+    address.copyToUTF8(text, length + 1);
+}
+
+bool OSCHandler::Address::isStartOf(const char *incoming) const
+{
+    for (int i = 0; i < length; ++i)
+    {
+        // (this also stops at the end of incoming)
+        if (CharacterFunctions::toLowerCase((juce_wchar) (uint8) incoming[i])
+            != CharacterFunctions::toLowerCase((juce_wchar) (uint8) text[i]))
+            return false;
+    }
+
+    return true;
+}
+
+bool OSCHandler::Address::matches(const char *incoming) const
+{
+    return isStartOf(incoming) && incoming[length] == 0;
 }
 
 void OSCHandler::buttonPressCallback(const int &monomeCol, const int &monomeRow, const bool &state)
@@ -38,37 +88,142 @@ void OSCHandler::buttonPressCallback(const int &monomeCol, const int &monomeRow,
 
 void OSCHandler::setLED(const int &row, const int &col, const int &val)
 {
-    p.Clear();
-    const char * msg = ledStr.getCharPointer();
-    p << osc::BeginMessage(msg) << row << col << val << osc::EndMessage;
-    transmitSocket.Send(p.Data(), p.Size());
+    sender.sendLED(row, col, val != 0);
 }
 
 void OSCHandler::setRow(const int &row, const int &val)
 {
-    p.Clear();
-    const char * msg = ledRowStr.getCharPointer();
-    p << osc::BeginMessage(msg) << row << 0 << val << osc::EndMessage;
-    transmitSocket.Send(p.Data(), p.Size());
+    const uint8 masks[2] = { 0, (uint8) val };
+    sender.sendRow(row, masks, 2);
 }
 
 void OSCHandler::clearGrid()
 {
-    p.Clear();
-    const char * msg = ledClearStr.getCharPointer();
-    p << osc::BeginMessage(msg) << osc::EndMessage;
-    transmitSocket.Send(p.Data(), p.Size());
+    sender.sendClear();
+}
+
+void OSCHandler::sendLEDFrame(LEDFramebuffer &frame, const int &numRows, const int &numCols)
+{
+    if (!frame.isDirty()) return;
+
+    // if this many rows of an 8x8 block have changed, it's
+    // quicker to send the whole block as a frame message
+    const int frameThreshold = 4;
+
+    const int rowsToSend = jmin(numRows, (int) LEDFramebuffer::maxNumRows);
+    const int blocksToSend = jmin((numCols + LEDFramebuffer::blockSize - 1) / LEDFramebuffer::blockSize,
+                                  (int) LEDFramebuffer::numBlocks);
+    bool rowNeeded[LEDFramebuffer::maxNumRows] = { false };
+
+    for (int top = 0; top < rowsToSend; top += LEDFramebuffer::blockSize)
+    {
+        const int bottom = jmin(top + LEDFramebuffer::blockSize, rowsToSend);
+
+        for (int b = 0; b < blocksToSend; ++b)
+        {
+            int numDirty = 0;
+            for (int r = top; r < bottom; ++r)
+                if (frame.isRowDirty(r, b)) ++numDirty;
+
+            if (numDirty >= frameThreshold)
+            {
+                uint8 masks[LEDFramebuffer::blockSize] = { 0 };
+                for (int r = top; r < bottom; ++r)
+                    masks[r - top] = frame.getRowMask(r, b);
+
+                // (anything that didn't fit in the queue is tried again next frame)
+                if (sender.sendFrame(b * LEDFramebuffer::blockSize, top, masks))
+                    for (int r = top; r < bottom; ++r)
+                        frame.markShown(r, b);
+            }
+            else
+            {
+                for (int r = top; r < bottom; ++r)
+                    if (frame.isRowDirty(r, b)) rowNeeded[r] = true;
+            }
+        }
+    }
+
+    // the rest go as row messages (with the whole row in each)
+    for (int r = 0; r < rowsToSend; ++r)
+    {
+        if (!rowNeeded[r]) continue;
+
+        uint8 masks[LEDFramebuffer::numBlocks];
+        for (int b = 0; b < blocksToSend; ++b)
+            masks[b] = frame.getRowMask(r, b);
+
+        if (sender.sendRow(r, masks, blocksToSend))
+            for (int b = 0; b < blocksToSend; ++b)
+                frame.markShown(r, b);
+    }
+
+    // The sender's queue is only full if its thread can't keep up, so
+    // rows which didn't fit are left dirty to go with the next frame.
+    // Anything off the edge of the device never needs sending though.
+    for (int r = 0; r < LEDFramebuffer::maxNumRows; ++r)
+        for (int b = (r < rowsToSend) ? blocksToSend : 0; b < LEDFramebuffer::numBlocks; ++b)
+            frame.markShown(r, b);
 }
 
 void OSCHandler::ProcessMessage(const osc::ReceivedMessage& m, const IpEndpointName& /*remoteEndpoint*/)
 {
-    const String stripWildcard = OSCPrefix + "strip/*";
+    const char *address = m.AddressPattern();
 
     try
     {
-        String msgPattern = m.AddressPattern();
+        // Work out which message this is first (the lock only stops the
+        // prefix changing underneath us), then handle it.
+        int stripID = -1, command = -1;
+        bool isPress = false, isProfileQuery = false, isProfileReset = false, isTraceDump = false;
 
-        if (msgPattern.equalsIgnoreCase(OSCPrefix + "press"))
+        {
+            const ScopedLock sl(addressLock);
+
+            if (pressAddress.matches(address))
+                isPress = true;
+
+            else if (profileAddress.matches(address))
+                isProfileQuery = true;
+
+            else if (profileResetAddress.matches(address))
+                isProfileReset = true;
+
+            else if (traceDumpAddress.matches(address))
+                isTraceDump = true;
+
+            else if (stripAddress.isStartOf(address))
+            {
+                // what's left should be <stripID>/<command>
+                const char *c = address + stripAddress.length;
+
+                if (*c >= '0' && *c <= '9')
+                {
+                    // (any more digits than this and it can't be a strip,
+                    // so the '/' check below fails rather than overflowing)
+                    const int maxStripIDDigits = 4;
+                    int numDigits = 0;
+
+                    stripID = 0;
+                    while (*c >= '0' && *c <= '9' && numDigits++ < maxStripIDDigits)
+                        stripID = stripID * 10 + (*c++ - '0');
+
+                    if (*c++ == '/')
+                    {
+                        for (int i = 0; i < numStripCommands; ++i)
+                        {
+                            if (strcmp(c, stripCommandNames[i]) == 0)
+                            {
+                                command = i;
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        if (isPress)
         {
             // we need three arguments for button presses
             const int numArgs = m.ArgumentCount();
@@ -76,68 +231,103 @@ void OSCHandler::ProcessMessage(const osc::ReceivedMessage& m, const IpEndpointN
 
             osc::ReceivedMessageArgumentStream args = m.ArgumentStream();
 
-            // unpack the monome button, row and state (button up or down)
-            osc::int32 row, col, state;
-            args >> row >> col >> state >> osc::EndMessage;
-            buttonPressCallback(row, col, state == 1);
+            // unpack the monome button's x (column), y (row) and
+            // state (button up or down)
+            osc::int32 x, y, state;
+            args >> x >> y >> state >> osc::EndMessage;
+            parent->getTraceRecorder().record(TraceRecorder::evPressReceived, x, y);
+            buttonPressCallback(x, y, state == 1);
         }
-        else if (msgPattern.matchesWildcard(stripWildcard, false))
+        else if (command >= 0)
         {
-            // strip off the /mlrvst/strip/ part of the message
-            msgPattern = msgPattern.substring(stripWildcard.length() - 1);
-
-            // and extract the SampleStrip rowID from the message
-            const String rowIDStr = msgPattern.upToFirstOccurrenceOf("/", false, false);
-
-            const int stripID = rowIDStr.getIntValue();
-
-            handleStripMessage(stripID, m);
+            handleStripMessage(stripID, command, m);
+        }
+        else if (isProfileQuery)
+        {
+            sendProfile();
+        }
+        else if (isProfileReset)
+        {
+            parent->resetProfilerPeaks();
+        }
+        else if (isTraceDump)
+        {
+            parent->requestTraceDump();
         }
     }
     catch (osc::Exception& e)
     {
-        DBG("error while parsing message: " << m.AddressPattern() << ": " << e.what() << "\n");
+        DBG("error while parsing message: " << address << ": " << e.what() << "\n");
     }
 }
 
-void OSCHandler::handleStripMessage(const int &stripID, const osc::ReceivedMessage& m)
+void OSCHandler::handleStripMessage(const int &stripID, const int &command, const osc::ReceivedMessage& m)
 {
-    const String msgPattern = m.AddressPattern();
-    const String OSCcommand = msgPattern.fromFirstOccurrenceOf("/" + String(stripID) + "/", false, false);
-
-    DBG("strip " << stripID << " sends command: " << OSCcommand);
-
-    if (OSCcommand == "vol")
+    switch (command)
     {
-        try
+    case stripVolume :
         {
-            const float newVol = getFloatOSCArg(m);
-            parent->setSampleStripParameter(SampleStrip::pStripVolume, &newVol, stripID);
+            try
+            {
+                const float newVol = getFloatOSCArg(m);
+                parent->setSampleStripParameter(SampleStrip::pStripVolume, &newVol, stripID);
+            }
+            catch (osc::Exception &) { DBG("Couldn't process volume message"); }
+            break;
         }
-        catch (osc::Exception &) { DBG("Couldn't process volume message"); }
-    }
 
+    case stripSpeed :
+        {
+            try
+            {
+                const float newSpeed = getFloatOSCArg(m);
+
+                // (the play speed is a double, so use the typed setter)
+                if (stripID >= 0 && stripID < parent->getGlobalSetting<GlobalSettings::sNumSampleStrips>())
+                    parent->getSampleStrip(stripID)->setSampleStripParam<SampleStrip::pPlaySpeed>((double) newSpeed);
+            }
+            catch (osc::Exception &) { DBG("Couldn't process speed message"); }
+            break;
+        }
 
-    else if (OSCcommand == "speed")
-    {
-        try
+    case stripChannel :
         {
-            const float newSpeed = getFloatOSCArg(m);
-            parent->setSampleStripParameter(SampleStrip::pPlaySpeed, &newSpeed, stripID);
+            try
+            {
+                const int newChannel = getIntOSCArg(m);
+                parent->setSampleStripParameter(SampleStrip::pCurrentChannel, &newChannel, stripID);
+            }
+            catch (osc::Exception &) { DBG("Couldn't process channel message"); }
+            break;
         }
-        catch (osc::Exception &) { DBG("Couldn't process speed message"); }
+
+    default :
+        jassertfalse;
     }
+}
 
-    else if (OSCcommand == "chan")
+
+void OSCHandler::sendProfile()
+{
+    const ProcessProfiler &profiler = parent->getProfiler();
+
+    for (int s = 0; s < ProcessProfiler::numStages; ++s)
     {
-        try
-        {
-            const int newChannel = getIntOSCArg(m);
-            parent->setSampleStripParameter(SampleStrip::pCurrentChannel, &newChannel, stripID);
-        }
-        catch (osc::Exception &) { DBG("Couldn't process channel message"); }
+        const int times[2] = { roundToInt(profiler.getStageTime(s)), roundToInt(profiler.getStagePeak(s)) };
+        sender.sendProfile(OSCSender::cmdProfileStage, s, times, 2);
+    }
 
+    const int numStrips = jmin(parent->getGlobalSetting<GlobalSettings::sNumSampleStrips>(),
+                               (int) ProcessProfiler::maxNumStrips);
+    for (int s = 0; s < numStrips; ++s)
+    {
+        const int times[2] = { roundToInt(profiler.getStripTime(s)), roundToInt(profiler.getStripPeak(s)) };
+        sender.sendProfile(OSCSender::cmdProfileStrip, s, times, 2);
     }
+
+    const int load[5] = { roundToInt(100.0f * profiler.getLoad()), roundToInt(100.0f * profiler.getPeakLoad()),
+                          profiler.getNumOverruns(), profiler.getLastOverrunStage(), profiler.getLastOverrunStrip() };
+    sender.sendProfile(OSCSender::cmdProfileLoad, 0, load, 5);
 }
 
 
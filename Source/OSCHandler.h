@@ -1,11 +1,8 @@
 #ifndef __OSCHANDLER__
 #define __OSCHANDLER__
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 
-// OSC send includes
-#include "osc/OscOutboundPacketStream.h"
-#include "ip/IpEndpointName.h"
 // OSC receive includes
 #include "osc/OscReceivedElements.h"
 #include "osc/OscPacketListener.h"
@@ -13,6 +10,8 @@
 #include "ip/UdpSocket.h"
 
 #include "AudioSample.h"
+#include "LEDFramebuffer.h"
+#include "OSCSender.h"
 
 // forward declaration
 class mlrVSTAudioProcessor;
@@ -44,19 +43,15 @@ public:
     }
 
     void buttonPressCallback(const int &monomeCol, const int &monomeRow, const bool &state);
+    // These are all queued for the sender thread, so they never block
+    // (and can be used from any thread, see OSCSender::send).
     void setLED(const int &row, const int &col, const int &val);
     void setRow(const int &row, const int &val);
     void clearGrid();
-    void setPrefix(const String &prefix)
-    {
-        OSCPrefix = "/" + prefix + "/";
-        ledStr = OSCPrefix + "led";
-        ledRowStr = OSCPrefix + "led_row";
-        ledClearStr = OSCPrefix + "clear";
-        buttonPressMask = OSCPrefix + "press";
-
-        DBG("prefix now: " << OSCPrefix);
-    }
+    // sends whatever has changed in the frame (the sender bundles it up)
+    void sendLEDFrame(LEDFramebuffer &frame, const int &numRows, const int &numCols);
+    // (this also rebuilds the addresses we listen for)
+    void setPrefix(const String &prefix);
 
 private:
     // incoming /////////////////////////////
@@ -67,16 +62,39 @@ private:
 
 
     // outgoing messages ////////////////////
-    char buffer[1536];                  // to store message data
-    osc::OutboundPacketStream p;
-    UdpTransmitSocket transmitSocket;
+    OSCSender sender;
 
     // strings ////////////////////////////
     String OSCPrefix;                       // main prefix (/mlrvst/ by default)
-    String ledStr, ledRowStr, ledClearStr;  // + "led", + "led_row", + "clear"
-    String buttonPressMask;                 // + "press"
 
-    void handleStripMessage(const int &stripID, const osc::ReceivedMessage& m);
+    // Incoming addresses are matched against these (without creating
+    // any Strings) as there can be a lot of messages. They are only
+    // rebuilt when the prefix changes, hence the lock.
+    struct Address
+    {
+        Address() : length(0) {}
+        void set(const String &address);
+        // case insensitive, like the monome protocol
+        bool matches(const char *incoming) const;
+        bool isStartOf(const char *incoming) const;
+
+        HeapBlock<char> text;
+        int length;
+    };
+    Address pressAddress;                   // + "press"
+    Address stripAddress;                   // + "strip/"
+    Address profileAddress;                 // + "profile" (replies with the timings)
+    Address profileResetAddress;            // + "profile/reset"
+    Address traceDumpAddress;               // + "trace/dump"
+    CriticalSection addressLock;
+
+    // commands for a strip, e.g. /mlrvst/strip/3/vol
+    enum StripCommand { stripVolume, stripSpeed, stripChannel, numStripCommands };
+    static const char* const stripCommandNames[numStripCommands];
+
+    void handleStripMessage(const int &stripID, const int &command, const osc::ReceivedMessage& m);
+    // replies to a profile query with the processBlock timings
+    void sendProfile();
 
     float getFloatOSCArg(const osc::ReceivedMessage& m);
     int getIntOSCArg(const osc::ReceivedMessage& m);
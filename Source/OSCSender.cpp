@@ -0,0 +1,359 @@
+/*
+  ==============================================================================
+
+    OSCSender.cpp
+    Created: 19 Oct 2026 4:02:17am
+    Author:  hemmer
+
+  ==============================================================================
+*/
+
+#include "OSCSender.h"
+#include "TraceRecorder.h"
+
+OSCSender::OSCSender(const String &hostName, const int &port) :
+    Thread("OscSender Thread"),
+    enqueuePosition(0), dequeuePosition(0),
+    numPending(0), wakeUp(),
+    addressLock(), ledStr(), ledRowStr(), ledClearStr(), ledFrameStr(),
+    profileStageStr(), profileStripStr(), profileLoadStr(),
+    buffer(), p(buffer, maxPacketSize),
+    transmitSocket(IpEndpointName(hostName.toUTF8(), port)),
+    traceRecorder(nullptr)
+{
+    static_jassert((queueSize & (queueSize - 1)) == 0);
+
+    // each cell says which turn of the ring it's ready to be written on
+    for (uint32 i = 0; i < queueSize; ++i)
+        queue[i].sequence = i;
+}
+
+OSCSender::~OSCSender()
+{
+    signalThreadShouldExit();
+    wakeUp.signal();
+    stopThread(2000);
+
+    // send anything that was queued on the way out (e.g. clearing the grid)
+    Command command;
+    while (pop(command))
+        addPending(command);
+    sendPending();
+}
+
+void OSCSender::setPrefix(const String &prefix)
+{
+    const ScopedLock sl(addressLock);
+
+    ledStr = prefix + "led";
+    ledRowStr = prefix + "led_row";
+    ledClearStr = prefix + "clear";
+    ledFrameStr = prefix + "frame";
+    profileStageStr = prefix + "profile/stage";
+    profileStripStr = prefix + "profile/strip";
+    profileLoadStr = prefix + "profile/load";
+}
+
+
+// Queue ///////////////////////////////////////////////////////////
+
+bool OSCSender::send(const Command &command, const bool &wakeSender)
+{
+    uint32 position = enqueuePosition.get();
+    Cell *cell;
+
+    for (;;)
+    {
+        cell = &queue[position & (queueSize - 1)];
+        const int diff = (int) (cell->sequence.get() - position);
+
+        // this cell is free, so try to claim it
+        if (diff == 0)
+        {
+            if (enqueuePosition.compareAndSetBool(position + 1, position))
+                break;
+        }
+        // the sender hasn't got round to this cell yet, so we're full
+        else if (diff < 0)
+        {
+            return false;
+        }
+
+        // someone else got there first
+        position = enqueuePosition.get();
+    }
+
+    cell->command = command;
+    // (this makes it visible to the sender thread)
+    cell->sequence = position + 1;
+
+    if (wakeSender)
+        wakeUp.signal();
+
+    return true;
+}
+
+bool OSCSender::pop(Command &command)
+{
+    Cell &cell = queue[dequeuePosition & (queueSize - 1)];
+
+    // nothing has been written here yet (or it's still being written)
+    if ((int) (cell.sequence.get() - (dequeuePosition + 1)) < 0)
+        return false;
+
+    command = cell.command;
+    // ready for the next time around the ring
+    cell.sequence = dequeuePosition + queueSize;
+    ++dequeuePosition;
+
+    return true;
+}
+
+bool OSCSender::sendLED(const int &x, const int &y, const bool &state)
+{
+    Command c;
+    c.type = cmdLED;
+    c.x = (uint8) x;
+    c.y = (uint8) y;
+    c.numMasks = 1;
+    c.masks[0] = state ? 1 : 0;
+
+    return send(c);
+}
+
+bool OSCSender::sendRow(const int &y, const uint8 *masks, const int &numMasks)
+{
+    jassert(numMasks > 0 && numMasks <= 8);
+
+    Command c;
+    c.type = cmdRow;
+    c.x = 0;
+    c.y = (uint8) y;
+    c.numMasks = (uint8) jlimit(1, 8, numMasks);
+    for (int i = 0; i < c.numMasks; ++i)
+        c.masks[i] = masks[i];
+
+    return send(c);
+}
+
+bool OSCSender::sendFrame(const int &x, const int &y, const uint8 *masks)
+{
+    Command c;
+    c.type = cmdFrame;
+    c.x = (uint8) x;
+    c.y = (uint8) y;
+    c.numMasks = 8;
+    for (int i = 0; i < 8; ++i)
+        c.masks[i] = masks[i];
+
+    return send(c);
+}
+
+bool OSCSender::sendClear()
+{
+    Command c;
+    c.type = cmdClear;
+    c.x = c.y = c.numMasks = 0;
+
+    return send(c);
+}
+
+bool OSCSender::sendProfile(const int &type, const int &index, const int *values, const int &numValues)
+{
+    jassert(type >= cmdProfileStage && type <= cmdProfileLoad);
+
+    Command c;
+    c.type = (uint8) type;
+    c.x = (uint8) index;
+    c.y = 0;
+    c.numMasks = (uint8) jlimit(0, 5, numValues);
+    for (int i = 0; i < c.numMasks; ++i)
+        c.values[i] = values[i];
+
+    return send(c);
+}
+
+
+// Sender thread ///////////////////////////////////////////////////
+
+void OSCSender::run()
+{
+    while (!threadShouldExit())
+    {
+        // (the audio thread doesn't wake us, so check every so often)
+        wakeUp.wait(20);
+
+        Command command;
+        while (pop(command))
+            addPending(command);
+
+        sendPending();
+    }
+}
+
+void OSCSender::addPending(const Command &command)
+{
+    if (numPending == queueSize)
+        sendPending();
+
+    // drop anything waiting that this command completely overwrites
+    for (int i = 0; i < numPending; ++i)
+    {
+        if (!isPendingLive[i]) continue;
+
+        const Command &old = pending[i];
+        bool isCovered = false;
+
+        switch (command.type)
+        {
+        case cmdClear :
+            isCovered = true;
+            break;
+
+        case cmdRow :
+            isCovered = (old.type == cmdLED && old.y == command.y && old.x < 8 * command.numMasks)
+                     || (old.type == cmdRow && old.y == command.y && old.numMasks <= command.numMasks);
+            break;
+
+        case cmdFrame :
+            isCovered = (old.type == cmdFrame && old.x == command.x && old.y == command.y)
+                     || (old.type == cmdLED && old.x >= command.x && old.x < command.x + 8
+                                            && old.y >= command.y && old.y < command.y + 8);
+            break;
+
+        case cmdLED :
+            isCovered = (old.type == cmdLED && old.x == command.x && old.y == command.y);
+            break;
+
+        case cmdProfileStage :
+        case cmdProfileStrip :
+        case cmdProfileLoad :
+            isCovered = (old.type == command.type && old.x == command.x);
+            break;
+
+        default :
+            jassertfalse;
+        }
+
+        if (isCovered)
+            isPendingLive[i] = false;
+    }
+
+    pending[numPending] = command;
+    isPendingLive[numPending] = true;
+    ++numPending;
+}
+
+void OSCSender::sendPending()
+{
+    if (numPending == 0) return;
+
+    const ScopedLock sl(addressLock);
+
+    int numInBundle = 0;
+    p.Clear();
+    p << osc::BeginBundleImmediate;
+
+    for (int i = 0; i < numPending; ++i)
+    {
+        if (!isPendingLive[i]) continue;
+
+        const Command &c = pending[i];
+        const String *address;
+        int numArgs;
+
+        switch (c.type)
+        {
+        case cmdLED :   address = &ledStr;      numArgs = 3;                break;
+        case cmdRow :   address = &ledRowStr;   numArgs = 1 + c.numMasks;   break;
+        case cmdFrame : address = &ledFrameStr; numArgs = 2 + 8;            break;
+        case cmdProfileStage :  address = &profileStageStr; numArgs = 1 + c.numMasks;   break;
+        case cmdProfileStrip :  address = &profileStripStr; numArgs = 1 + c.numMasks;   break;
+        case cmdProfileLoad :   address = &profileLoadStr;  numArgs = c.numMasks;       break;
+        default :       address = &ledClearStr; numArgs = 0;                break;
+        }
+
+        // the size of the message in the bundle (each part is padded to 4 bytes)
+        const int addressSize = ((int) address->getNumBytesAsUTF8() + 4) & ~3;
+        const int typeTagSize = (numArgs + 2 + 3) & ~3;
+        const int messageSize = 4 + addressSize + typeTagSize + 4 * numArgs;
+
+        try
+        {
+            // if this won't fit in the packet, send what we have so far
+            if (numInBundle > 0 && (int) p.Size() + messageSize > maxPacketSize)
+            {
+                p << osc::EndBundle;
+                transmit(numInBundle);
+
+                numInBundle = 0;
+                p.Clear();
+                p << osc::BeginBundleImmediate;
+            }
+
+            p << osc::BeginMessage(address->toUTF8());
+
+            switch (c.type)
+            {
+            case cmdLED :
+                p << (int) c.x << (int) c.y << (int) c.masks[0];
+                break;
+            case cmdRow :
+                p << (int) c.y;
+                for (int m = 0; m < c.numMasks; ++m)
+                    p << (int) c.masks[m];
+                break;
+            case cmdFrame :
+                p << (int) c.x << (int) c.y;
+                for (int m = 0; m < 8; ++m)
+                    p << (int) c.masks[m];
+                break;
+            case cmdProfileStage :
+            case cmdProfileStrip :
+                p << (int) c.x;
+                for (int v = 0; v < c.numMasks; ++v)
+                    p << c.values[v];
+                break;
+            case cmdProfileLoad :
+                for (int v = 0; v < c.numMasks; ++v)
+                    p << c.values[v];
+                break;
+            default :
+                break;
+            }
+
+            p << osc::EndMessage;
+            ++numInBundle;
+        }
+        catch (std::exception &e)
+        {
+            // Failed sends (or a prefix so long that the message doesn't
+            // fit) are just dropped, we don't want to hold anything up.
+            DBG("OSC send failed: " << e.what());
+
+            numInBundle = 0;
+            p.Clear();
+            p << osc::BeginBundleImmediate;
+        }
+    }
+
+    if (numInBundle > 0)
+    {
+        try
+        {
+            p << osc::EndBundle;
+            transmit(numInBundle);
+        }
+        catch (std::exception &e) { DBG("OSC send failed: " << e.what()); }
+    }
+
+    numPending = 0;
+}
+
+void OSCSender::transmit(const int &numMessages)
+{
+    transmitSocket.Send(p.Data(), p.Size());
+
+    if (traceRecorder != nullptr)
+        traceRecorder->record(TraceRecorder::evLEDSend, numMessages, (int) p.Size());
+}
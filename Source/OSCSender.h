@@ -0,0 +1,127 @@
+/*
+  ==============================================================================
+
+    OSCSender.h
+    Created: 19 Oct 2026 4:02:17am
+    Author:  hemmer
+
+    Sends everything going out to the monome (LEDs etc) from its own
+    thread. Any thread can queue a command: the queue is a fixed size,
+    lock-free ring that can be written by several threads at once, so
+    queueing never locks, allocates or waits on the socket (if it's full
+    the command is dropped). The sender thread gathers up what's queued,
+    drops anything which a later command overwrites (e.g. two updates to
+    the same row) and sends the rest as bundles no bigger than a packet.
+
+  ==============================================================================
+*/
+
+#ifndef OSCSENDER_H_INCLUDED
+#define OSCSENDER_H_INCLUDED
+
+#include "JuceHeader.h"
+
+// OSC send includes
+#include "osc/OscOutboundPacketStream.h"
+#include "ip/IpEndpointName.h"
+#include "ip/UdpSocket.h"
+
+class TraceRecorder;
+
+
+class OSCSender : public Thread
+{
+public:
+    OSCSender(const String &hostName, const int &port);
+    ~OSCSender();
+
+    // the prefix is "/mlrvst/" style (i.e. with both slashes)
+    void setPrefix(const String &prefix);
+
+    // each packet sent is logged here (if set)
+    void setTraceRecorder(TraceRecorder *recorder) { traceRecorder = recorder; }
+
+    enum CommandType
+    {
+        cmdLED,         // one LED: x, y, state
+        cmdRow,         // a whole row: y, masks (one per 8 LEDs)
+        cmdFrame,       // an 8x8 block: x, y, 8 masks (one per row)
+        cmdClear,       // everything off
+
+        // replies to a profile query (see ProcessProfiler)
+        cmdProfileStage,    // x = stage, values = last / peak time (us)
+        cmdProfileStrip,    // x = strip, values = last / peak time (us)
+        cmdProfileLoad      // values = load / peak load (%), overruns, last overrun stage / strip
+    };
+
+    struct Command
+    {
+        uint8 type, x, y, numMasks;     // (numMasks is also how many values there are)
+        uint8 masks[8];
+        int values[5];
+    };
+
+    /* Queues a command for the sender thread. This never locks or
+       allocates, so can be used from any thread (including the audio
+       thread, which should pass wakeSender = false as waking the thread
+       can lock). Returns false if the queue is full.
+    */
+    bool send(const Command &command, const bool &wakeSender = true);
+
+    // some shortcuts
+    bool sendLED(const int &x, const int &y, const bool &state);
+    bool sendRow(const int &y, const uint8 *masks, const int &numMasks);
+    bool sendFrame(const int &x, const int &y, const uint8 *masks);
+    bool sendClear();
+    bool sendProfile(const int &type, const int &index, const int *values, const int &numValues);
+
+    void run();
+
+private:
+
+    enum
+    {
+        queueSize = 1024,       // (must be a power of two)
+        maxPacketSize = 1400    // keeps us under the usual MTU
+    };
+
+    // the queue (a bounded multi-producer, single-consumer ring)
+    struct Cell
+    {
+        Atomic<uint32> sequence;
+        Command command;
+    };
+    Cell queue[queueSize];
+    Atomic<uint32> enqueuePosition;
+    uint32 dequeuePosition;
+
+    bool pop(Command &command);
+
+    // (sender thread) what is waiting to be sent, in order
+    Command pending[queueSize];
+    bool isPendingLive[queueSize];
+    int numPending;
+
+    void addPending(const Command &command);
+    void sendPending();
+    // sends the bundle in p, which has this many messages
+    void transmit(const int &numMessages);
+
+    WaitableEvent wakeUp;
+
+    // the outgoing addresses (changed when the prefix is)
+    CriticalSection addressLock;
+    String ledStr, ledRowStr, ledClearStr, ledFrameStr;
+    String profileStageStr, profileStripStr, profileLoadStr;
+
+    char buffer[maxPacketSize];
+    osc::OutboundPacketStream p;
+    UdpTransmitSocket transmitSocket;
+
+    TraceRecorder *traceRecorder;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OSCSender);
+};
+
+
+#endif  // OSCSENDER_H_INCLUDED
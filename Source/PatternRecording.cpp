@@ -16,27 +16,38 @@ class mlrVSTAudioProcessor;
 
 PatternRecording::PatternRecording(mlrVSTAudioProcessor* owner, const int &idNumber) :
     slotID(idNumber),
-    // MIDI //////////////////
-    midiPattern(), noteOffs(),
     // Properties ////////////////////////////////////////////////////////////
     isPatternRecording(false), isPatternPlaying(false),
     isPatternStopping(false), doesPatternLoop(true),
     patternLength(8), patternPrecountLength(0),
-    patternLengthInSamples(0), patternPrecountLengthInSamples(0),
-    patternPosition(0), patternPrecountPosition(0),
+    patternLengthInTicks(0), patternPrecountLengthInTicks(0),
+    patternPosition(0.0), patternPrecountPosition(0.0),
     patternBank(0),
+    // Events //////////////////
+    events(), heldNotes(), changeCount(0), numDroppedEvents(0), numBlockEvents(0),
+    playbackIndex(0), playbackOffset(0),
+    hostStartPosition(0.0), hasHostStart(false),
     // Communication /////////
-    parent(owner)
+    parent(owner),
+    producerLock(), commandFifo(commandQueueSize)
 {
-
+    events.ensureStorageAllocated(maxNumEvents);
+    heldNotes.ensureStorageAllocated(maxNumHeldNotes);
 }
 
 
-void PatternRecording::recordPattern(MidiBuffer &midiMessages, const int &numSamples)
+double PatternRecording::getTicksPerSample(const double &bpm, const double &sampleRate)
+{
+    if (sampleRate <= 0.0) return 0.0;
+    return bpm * ticksPerBeat / (60.0 * sampleRate);
+}
+
+void PatternRecording::recordPattern(const MidiBuffer &midiMessages, const int &numSamples,
+                                     const double &ticksPerSample, const double *hostPositionInBeats)
 {
     // if we are recording the pattern, just rip the
     // MIDI messages from the incoming buffer
-    if (isPatternRecording)
+    if (isPatternRecording && ticksPerSample > 0.0)
     {
         // get the iterator for the incoming buffer
         // so we can check through the messages
@@ -44,130 +55,125 @@ void PatternRecording::recordPattern(MidiBuffer &midiMessages, const int &numSam
         MidiMessage message (0xf4, 0.0);
         int time;
 
+        const double blockLengthInTicks = numSamples * ticksPerSample;
+
         // if we are still during the precount, do nothing
-        if (patternPrecountPosition > numSamples)
-            patternPrecountPosition -= numSamples;
+        if (patternPrecountPosition > blockLengthInTicks)
+            patternPrecountPosition -= blockLengthInTicks;
 
         // if the precount finishes during this buffer
-        else if (patternPrecountPosition > 0)
+        else if (patternPrecountPosition > 0.0)
         {
+            // (odd while the notes change, see copyEvents)
+            ++changeCount;
+
             // TODO: overdub could be option here?
-            midiPattern.clear();
+            events.clearQuick();
 
-            const int numSamplesToAdd = numSamples - patternPrecountPosition;
+            // the pattern starts this many samples into the block
+            const double startSample = patternPrecountPosition / ticksPerSample;
 
-            // DBG("#1 recording " << numSamplesToAdd << " of midi, pos: " << patternPrecountPosition);
+            // (which is where the host will be at the start of each loop)
+            hasHostStart = (hostPositionInBeats != nullptr);
+            if (hasHostStart)
+                hostStartPosition = *hostPositionInBeats + patternPrecountPosition / ticksPerBeat;
 
             // get messages from the main MIDI message queue
             while(i.getNextEvent(message, time))
             {
                 // and add them if they occur after the precount runs out
-                if (time > patternPrecountPosition)
-                {
-                    midiPattern.addEvent(message, time - patternPrecountPosition);
-
-                    // store noteOffs to fire at end
-                    if (message.isNoteOn())
-                    {
-                        MidiMessage tempNoteOff = MidiMessage::noteOff(message.getChannel(), message.getNoteNumber(), message.getVelocity());
-                        noteOffs.addEvent(tempNoteOff, 0);
-                    }
-                }
+                if (time > startSample)
+                    recordEvent(message, (int) ((time - startSample) * ticksPerSample));
             }
 
-            // the precount has finished
-            patternPrecountPosition = 0;
-            // we are now numSamplesToAdd into the buffer
-            patternPosition = numSamplesToAdd;
+            // we are now this far into the pattern
+            patternPosition = blockLengthInTicks - patternPrecountPosition;
+            // and the precount has finished
+            patternPrecountPosition = 0.0;
+
+            ++changeCount;
         }
         else
         {
+            // (if there was no precount, the pattern started at the first block)
+            if (!hasHostStart && hostPositionInBeats != nullptr)
+            {
+                hostStartPosition = *hostPositionInBeats - patternPosition / ticksPerBeat;
+                hasHostStart = true;
+            }
+
+            const bool isFinishing = (patternPosition + blockLengthInTicks >= patternLengthInTicks);
+
+            // only blocks that can add notes count as a change,
+            // otherwise the GUI would recache every block
+            const bool canAddEvents = isFinishing || !midiMessages.isEmpty();
+            if (canAddEvents) ++changeCount;
+
             // if we are during recording (and not near the end), just
             // add the current input into the record buffer
-            if (numSamples + patternPosition < patternLengthInSamples)
+            if (!isFinishing)
             {
-                // DBG("#2 recording " << numSamples << " of midi, pos: " << patternPosition);
-
                 // get messages from the main MIDI message queue
                 while(i.getNextEvent(message, time))
-                {
-                    midiPattern.addEvent(message, time + patternPosition);
-
-                    // store noteOffs to fire at end
-                    if (message.isNoteOn())
-                    {
-                        MidiMessage tempNoteOff = MidiMessage::noteOff(message.getChannel(), message.getNoteNumber(), message.getVelocity());
-                        noteOffs.addEvent(tempNoteOff, 0);
-                    }
-                }
+                    recordEvent(message, (int) (patternPosition + time * ticksPerSample));
 
-                //midiPattern.addEvents(midiMessages, 0, numSamples, -patternPosition);
-                patternPosition += numSamples;
+                patternPosition += blockLengthInTicks;
             }
             // otherwise we are finishing up
             else
             {
-                const int numSamplesLeftToRecord = patternLengthInSamples - patternPosition;
+                const double samplesLeftToRecord = (patternLengthInTicks - patternPosition) / ticksPerSample;
 
                 // add remaining messages from the main MIDI message queue
                 while(i.getNextEvent(message, time))
                 {
-                    if (time < numSamplesLeftToRecord)
-                        midiPattern.addEvent(message, time + patternPosition);
-
-                    // store noteOffs to fire at end
-                    if (message.isNoteOn())
-                    {
-                        MidiMessage tempNoteOff = MidiMessage::noteOff(message.getChannel(), message.getNoteNumber(), message.getVelocity());
-                        noteOffs.addEvent(tempNoteOff, 0);
-                    }
+                    if (time < samplesLeftToRecord)
+                        recordEvent(message, (int) (patternPosition + time * ticksPerSample));
                 }
 
                 // add the note offs to clear any "phantom notes"
-                midiPattern.addEvents(noteOffs, 0, 1, patternLengthInSamples - 1);
+                for (int n = 0; n < heldNotes.size() && events.size() < maxNumEvents; ++n)
+                {
+                    PatternEvent noteOff(heldNotes.getReference(n));
+                    noteOff.position = patternLengthInTicks - 1;
+                    events.add(noteOff);
+                }
 
                 // we are no longer recording
                 isPatternRecording = false;
 
-                // if we finish recording, let any listeners know
-                // so they can redraw representations of the pattern
-                sendChangeMessage();
-
                 DBG("pattern " << patternBank << " finished recording.");
 
 
-                // start playing back from the start straight away
+                // start playing back from the start straight away, which
+                // playPattern does for whatever is left of this block
                 isPatternStopping = false;
                 isPatternPlaying = true;
-                patternPosition = 0;
-
-                // fill the remaining buffer with the newly recorded sequence
-                const int samplesRemaining = numSamples - numSamplesLeftToRecord;
-                if (patternPosition + samplesRemaining < patternLengthInSamples)
-                {
-                    midiMessages.addEvents(midiPattern, patternPosition, samplesRemaining, numSamplesLeftToRecord);
-                    patternPosition += samplesRemaining;
-                }
-
+                patternPosition = 0.0;
+                playbackIndex = 0;
+                playbackOffset = (int) ceil(samplesLeftToRecord);
             }
 
             // Let the PatternStripControl know to recache pattern
-            sendChangeMessage();
+            if (canAddEvents) ++changeCount;
         }
     }
 }
-void PatternRecording::playPattern(MidiBuffer &midiMessages, const int &numSamples)
+void PatternRecording::playPattern(Array<StripEventRouter::Event> &blockEvents, const int &numSamples,
+                                   const double &ticksPerSample, const double *hostPositionInBeats)
 {
+    numBlockEvents = 0;
+
     // if the pattern is playing, add its events to the
-    // Midi message queue
-    if (isPatternPlaying)
+    // ones for this block
+    if (isPatternPlaying && ticksPerSample > 0.0)
     {
         // if we are stopping
         if (isPatternStopping)
         {
             // add the note off events to the end off the buffer
             // to avoid any hanging notes
-            midiMessages.addEvents(noteOffs, 0, 1, numSamples - 1);
+            addHeldNoteOffs(blockEvents, numSamples - 1);
 
             isPatternPlaying = false;
             isPatternStopping = false;
@@ -176,24 +182,37 @@ void PatternRecording::playPattern(MidiBuffer &midiMessages, const int &numSampl
             return;
         }
 
-        // calculate the correction to timesteps relative
-        // to the current MIDI buffer
-        const int correction = -patternPosition;
+        // when following the host, go wherever it goes (unless we've only
+        // just finished recording, in which case we're already in line)
+        if (hostPositionInBeats != nullptr && playbackOffset == 0)
+            followHostPosition(*hostPositionInBeats);
 
-        if (patternPosition + numSamples < patternLengthInSamples)
+        // playback may start part way through the block (if
+        // the pattern has only just finished recording)
+        const int blockOffset = jmin(playbackOffset, numSamples);
+        const double ticksToPlay = (numSamples - blockOffset) * ticksPerSample;
+        playbackOffset = 0;
+
+        if (patternPosition + ticksToPlay < patternLengthInTicks)
         {
-            midiMessages.addEvents(midiPattern, patternPosition, numSamples, correction);
-            patternPosition += numSamples;
+            addEventsInRange(blockEvents, patternPosition, patternPosition + ticksToPlay,
+                             blockOffset, ticksPerSample, numSamples);
+            patternPosition += ticksToPlay;
         }
         else
         {
-            // see how many samples of the pattern we have left to play back
-            const int numToAdd = patternLengthInSamples - patternPosition;
-            // and add them to the main MIDI buffer
-            midiMessages.addEvents(midiPattern, patternPosition, numToAdd, correction);
+            // play what's left of the pattern...
+            addEventsInRange(blockEvents, patternPosition, patternLengthInTicks,
+                             blockOffset, ticksPerSample, numSamples);
+
+            // ...which finishes this far into the block
+            const double loopOffset = blockOffset + (patternLengthInTicks - patternPosition) / ticksPerSample;
+            const double ticksRemaining = patternPosition + ticksToPlay - patternLengthInTicks;
 
             // reset position
-            patternPosition = 0;
+            patternPosition = 0.0;
+            playbackIndex = 0;
+            parent->getTraceRecorder().record(TraceRecorder::evPatternWrap, slotID);
 
             // if we are looping the pattern
             if (doesPatternLoop)
@@ -201,15 +220,9 @@ void PatternRecording::playPattern(MidiBuffer &midiMessages, const int &numSampl
                 isPatternStopping = false;
                 isPatternPlaying = true;
 
-                // go back to the start of the pattern and add these samples
-                // to what remains of the main MIDI buffer
-                const int samplesRemainingInBuffer = numSamples - numToAdd;
-                // remembering that these are offset so as to start where
-                // the previously playing pattern finished
-                const int offset = numToAdd;
-
-                midiMessages.addEvents(midiPattern, patternPosition, samplesRemainingInBuffer, offset);
-                patternPosition += samplesRemainingInBuffer;
+                // go back to the start of the pattern for the rest of the block
+                addEventsInRange(blockEvents, 0.0, ticksRemaining, loopOffset, ticksPerSample, numSamples);
+                patternPosition = ticksRemaining;
             }
             else
             {
@@ -220,69 +233,316 @@ void PatternRecording::playPattern(MidiBuffer &midiMessages, const int &numSampl
     }
 }
 
-// Recording /////////////////////////////////
-void PatternRecording::startPatternRecording()
+void PatternRecording::sortEvents(Array<StripEventRouter::Event> &blockEvents)
 {
-    jassert(patternLength != 0);
+    for (int i = 1; i < blockEvents.size(); ++i)
+    {
+        const StripEventRouter::Event e(blockEvents.getReference(i));
 
-    const double currentBPM = *static_cast<const double*>(parent->getGlobalSetting(GlobalSettings::sCurrentBPM));
-    double sampleRate = parent->getSampleRate();
+        int j = i;
+        while (j > 0 && blockEvents.getReference(j - 1).position > e.position)
+        {
+            blockEvents.getReference(j) = blockEvents.getReference(j - 1);
+            --j;
+        }
 
-    patternLengthInSamples = (int) (sampleRate * (60.0 * patternLength / currentBPM));
-    patternPrecountLengthInSamples = (int) (sampleRate * (60.0 * patternPrecountLength / currentBPM));
+        blockEvents.getReference(j) = e;
+    }
+}
 
-    patternPrecountPosition = patternPrecountLengthInSamples;
+void PatternRecording::recordEvent(const MidiMessage &message, const int &position)
+{
+    // strips only listen to notes
+    if (!message.isNoteOnOrOff()) return;
+
+    PatternEvent e;
+    e.position = position;
+    e.channel = (uint8) message.getChannel();
+    e.noteNumber = (uint8) message.getNoteNumber();
+    e.isNoteOn = message.isNoteOn();
+
+    // (this is full of notes already so it's not worth allocating for)
+    if (events.size() < maxNumEvents)
+        events.add(e);
+    else
+        ++numDroppedEvents;
 
-    // remove any previous notes from the MidiBuffers
-    midiPattern.clear();
-    noteOffs.clear();
+    // store noteOffs to fire at end
+    if (e.isNoteOn)
+    {
+        for (int n = 0; n < heldNotes.size(); ++n)
+        {
+            const PatternEvent &held = heldNotes.getReference(n);
+            if (held.channel == e.channel && held.noteNumber == e.noteNumber)
+                return;
+        }
 
-    patternPosition = 0;
-    isPatternRecording = true;
+        // (never reallocate on the audio thread)
+        if (heldNotes.size() >= maxNumHeldNotes)
+        {
+            ++numDroppedEvents;
+            return;
+        }
 
-    // TODO: for overdub, this may change
-    isPatternPlaying = false;
+        e.isNoteOn = false;
+        heldNotes.add(e);
+    }
+}
 
-    DBG("pattern " + String(slotID) + " recording started");
+void PatternRecording::addEventsInRange(Array<StripEventRouter::Event> &blockEvents,
+                                        const double &startTick, const double &endTick,
+                                        const double &blockOffset, const double &ticksPerSample,
+                                        const int &numSamples)
+{
+    // the cursor is usually already at startTick, so
+    // this only looks at the notes in this block
+    while (playbackIndex < events.size())
+    {
+        const PatternEvent &p = events.getReference(playbackIndex);
+        if (p.position >= endTick) break;
+
+        ++playbackIndex;
+        if (p.position < startTick) continue;
+
+        // where this note falls at the current tempo
+        StripEventRouter::Event e;
+        e.position = jlimit(0, numSamples - 1, (int) (blockOffset + (p.position - startTick) / ticksPerSample));
+        e.order = 0;
+        e.stripID = p.channel - 1;
+        e.column = p.noteNumber;
+        e.isNoteOn = p.isNoteOn;
+        addToBlock(blockEvents, e);
+    }
 }
-void PatternRecording::stopPatternRecording()
+
+void PatternRecording::addHeldNoteOffs(Array<StripEventRouter::Event> &blockEvents, const int &position)
 {
-    // add the note offs to clear any "phantom notes"
-    midiPattern.addEvents(noteOffs, 0, 1, patternPosition);
+    for (int n = 0; n < heldNotes.size(); ++n)
+    {
+        const PatternEvent &p = heldNotes.getReference(n);
+
+        StripEventRouter::Event e;
+        e.position = position;
+        e.order = 0;
+        e.stripID = p.channel - 1;
+        e.column = p.noteNumber;
+        e.isNoteOn = false;
+        addToBlock(blockEvents, e);
+    }
+}
 
-    // we are no longer recording
-    isPatternRecording = false;
+void PatternRecording::addToBlock(Array<StripEventRouter::Event> &blockEvents, const StripEventRouter::Event &e)
+{
+    // never let the block's list reallocate on the audio thread
+    if (numBlockEvents >= maxEventsPerBlock)
+    {
+        ++numDroppedEvents;
+        return;
+    }
 
-    DBG("pattern " << patternBank << " stopped recording.");
+    blockEvents.add(e);
+    ++numBlockEvents;
 }
 
+// Recording /////////////////////////////////
+void PatternRecording::startPatternRecording() { queueCommand(cStartRecording); }
+void PatternRecording::stopPatternRecording() { queueCommand(cStopRecording); }
+
 
 // Playback /////////////////////////////
-void PatternRecording::startPatternPlaying(const int &position)
+void PatternRecording::startPatternPlaying(const int &position) { queueCommand(cStartPlaying, position); }
+void PatternRecording::resumePatternPlaying() { queueCommand(cResumePlaying); }
+void PatternRecording::stopPatternPlaying() { queueCommand(cStopPlaying); }
+
+
+// Commands /////////////////////////////
+void PatternRecording::queueCommand(const int &type, const int &position)
+{
+    Command command;
+    command.type = type;
+    command.position = position;
+
+    if (parent->isAudioThread())
+    {
+        applyCommand(command);
+        return;
+    }
+
+    bool wasQueued = false;
+    {
+        const ScopedLock sl (producerLock);
+
+        int start1, size1, start2, size2;
+        commandFifo.prepareToWrite(1, start1, size1, start2, size2);
+        if (size1 + size2 > 0)
+        {
+            pendingCommands[(size1 > 0) ? start1 : start2] = command;
+            commandFifo.finishedWrite(1);
+            wasQueued = true;
+        }
+    }
+
+    if (wasQueued && parent->isAudioRunning())
+        return;
+
+    // Nothing is going to apply the queue (or it's full), so do it now
+    // while holding off the audio thread, keeping everything in order.
+    const ScopedLock cl (parent->getCallbackLock());
+    applyPendingCommands();
+    if (!wasQueued) applyCommand(command);
+}
+
+void PatternRecording::applyPendingCommands()
+{
+    int start1, size1, start2, size2;
+    commandFifo.prepareToRead(commandFifo.getNumReady(), start1, size1, start2, size2);
+
+    for (int i = 0; i < size1; ++i) applyCommand(pendingCommands[start1 + i]);
+    for (int i = 0; i < size2; ++i) applyCommand(pendingCommands[start2 + i]);
+
+    commandFifo.finishedRead(size1 + size2);
+}
+
+void PatternRecording::applyCommand(const Command &command)
+{
+    switch (command.type)
+    {
+    case cStartRecording :
+        {
+            hasHostStart = false;
+
+            jassert(patternLength != 0);
+
+            patternLengthInTicks = patternLength * ticksPerBeat;
+            patternPrecountLengthInTicks = patternPrecountLength * ticksPerBeat;
+
+            patternPrecountPosition = patternPrecountLengthInTicks;
+
+            // remove any previous notes (keeping the space)
+            ++changeCount;
+            events.clearQuick();
+            heldNotes.clearQuick();
+            playbackIndex = 0;
+            ++changeCount;
+
+            patternPosition = 0.0;
+            isPatternRecording = true;
+
+            // TODO: for overdub, this may change
+            isPatternPlaying = false;
+
+            DBG("pattern " + String(slotID) + " recording started");
+            break;
+        }
+
+    case cStopRecording :
+        {
+            // add the note offs to clear any "phantom notes"
+            ++changeCount;
+            for (int n = 0; n < heldNotes.size() && events.size() < maxNumEvents; ++n)
+            {
+                PatternEvent noteOff(heldNotes.getReference(n));
+                noteOff.position = (int) patternPosition;
+                events.add(noteOff);
+            }
+            ++changeCount;
+
+            // we are no longer recording
+            isPatternRecording = false;
+
+            DBG("pattern " << patternBank << " stopped recording.");
+            break;
+        }
+
+    case cStartPlaying :
+        seek(command.position);
+
+        // (the host will be followed from here)
+        hasHostStart = false;
+
+        isPatternPlaying = true;
+        isPatternStopping = false;
+        break;
+
+    case cResumePlaying :
+        isPatternPlaying = true;
+        isPatternStopping = false;
+        break;
+
+    case cStopPlaying :
+        // signal that we are stopping
+        isPatternStopping = true;
+        break;
+
+    default :
+        jassertfalse;
+        break;
+    }
+}
+
+void PatternRecording::seek(const double &position)
 {
     patternPosition = position;
-    isPatternPlaying = true;
-    isPatternStopping = false;
+
+    // find the first note at or after the new position
+    int first = 0, last = events.size();
+    while (first < last)
+    {
+        const int middle = (first + last) / 2;
+        if (events.getReference(middle).position < position) first = middle + 1;
+        else last = middle;
+    }
+    playbackIndex = first;
 }
-void PatternRecording::resumePatternPlaying()
+
+void PatternRecording::followHostPosition(const double &hostPositionInBeats)
 {
-    isPatternPlaying = true;
-    isPatternStopping = false;
+    if (patternLengthInTicks <= 0) return;
+
+    if (!hasHostStart)
+    {
+        // start following the host from wherever we are now
+        hostStartPosition = hostPositionInBeats - patternPosition / ticksPerBeat;
+        hasHostStart = true;
+        return;
+    }
+
+    const double lengthInTicks = patternLengthInTicks;
+    double hostPosition = fmod((hostPositionInBeats - hostStartPosition) * ticksPerBeat, lengthInTicks);
+    if (hostPosition < 0.0) hostPosition += lengthInTicks;
+
+    // how far out we are (the short way round the loop)
+    double difference = hostPosition - patternPosition;
+    if (difference > lengthInTicks / 2) difference -= lengthInTicks;
+    else if (difference < -lengthInTicks / 2) difference += lengthInTicks;
+
+    // (anything less is just rounding / tempo ramps within a block)
+    if (fabs(difference) > maxHostDrift)
+        seek(hostPosition);
 }
-void PatternRecording::stopPatternPlaying()
+
+bool PatternRecording::copyEvents(Array<PatternEvent> &dest) const
 {
-    // signal that we are stopping
-    isPatternStopping = true;
+    const uint32 countBefore = changeCount.get();
+    if ((countBefore & 1) != 0) return false;
+
+    // (events never reallocates, so this is safe even if it's changing)
+    dest.clearQuick();
+    const PatternEvent *eventData = events.begin();
+    dest.addArray(eventData, jmin(events.size(), (int) maxNumEvents));
+
+    // if the audio thread changed it meanwhile, what we have is junk
+    return changeCount.get() == countBefore;
 }
 
 
 // Percentages ///////////////////////////
 float PatternRecording::getPatternPrecountPercent() const
 {
-    if (patternPrecountPosition <= 0 || patternPrecountLengthInSamples <= 0 || !isPatternRecording)
+    if (patternPrecountPosition <= 0 || patternPrecountLengthInTicks <= 0 || !isPatternRecording)
         return 0.0;
     else
-        return (float) (patternPrecountPosition) / (float) (patternPrecountLengthInSamples);
+        return (float) (patternPrecountPosition) / (float) (patternPrecountLengthInTicks);
 }
 float PatternRecording::getPatternPercent() const
 {
@@ -290,8 +550,8 @@ float PatternRecording::getPatternPercent() const
 	if (! isPatternPlaying && !isPatternRecording)
 		return 0.0;
 	// make sure we haven't messed up the calc
-	else if (patternPosition >= patternLengthInSamples || patternLengthInSamples <= 0)
+	else if (patternPosition >= patternLengthInTicks || patternLengthInTicks <= 0)
 		return 0.0;
     else
-        return (float) (patternPosition) / (float) (patternLengthInSamples);
+        return (float) (patternPosition) / (float) (patternLengthInTicks);
 }
\ No newline at end of file
@@ -11,57 +11,165 @@
 #ifndef __PATTERNRECORDING_H_E05E291D__
 #define __PATTERNRECORDING_H_E05E291D__
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 #include "PluginProcessor.h"
+#include "StripEventRouter.h"
 
-class PatternRecording : public ChangeBroadcaster
+class PatternRecording
 {
 public:
 
     PatternRecording(mlrVSTAudioProcessor* owner, const int &idNumber);
 
-    // rip MIDI messages from host and store them for playback
-    void recordPattern(MidiBuffer &midiMessages, const int &numSamples);
-    // add the pattern's MIDI messages to the main MIDI buffer for playback
-    void playPattern(MidiBuffer &midiMessages, const int &numSamples);
-
+    // A recorded note, kept small so long patterns stay compact
+    struct PatternEvent
+    {
+        int position;       // in ticks from the start of the pattern
+        uint8 channel;      // MIDI channel (strip + 1)
+        uint8 noteNumber;   // monome column
+        bool isNoteOn;
+    };
+
+    // patterns are preallocated so recording them never allocates
+    enum { maxNumEvents = 4096 };
+    // (one for each button of the biggest monome)
+    enum { maxNumHeldNotes = 16 * 16 };
+    // the processor reserves this many block events for each pattern
+    enum { maxEventsPerBlock = 64 };
+
+    // Patterns are timed in ticks rather than samples, so they stay in
+    // time with the strips when the tempo changes. This is fine enough
+    // to be sample accurate at any tempo (and 32 beats still fits an int).
+    enum { ticksPerBeat = 1 << 20 };
+    // how many ticks pass each sample (at this tempo / sample rate)
+    static double getTicksPerSample(const double &bpm, const double &sampleRate);
+
+    /* Rip MIDI messages from host and store them for playback. When we are
+       following the host, hostPositionInBeats is its position at the start
+       of the block (otherwise null), so playback can stay in line with it.
+    */
+    void recordPattern(const MidiBuffer &midiMessages, const int &numSamples, const double &ticksPerSample,
+                       const double *hostPositionInBeats = nullptr);
+    /* Adds the pattern's notes for this block to blockEvents (with positions
+       relative to the block). Each pattern's notes are added in order, but
+       those from several patterns need sorting (see sortEvents). If the
+       host's position is given, the pattern's position comes from that.
+    */
+    void playPattern(Array<StripEventRouter::Event> &blockEvents, const int &numSamples,
+                     const double &ticksPerSample, const double *hostPositionInBeats = nullptr);
+    // a stable insertion sort by position (blocks only have a few notes)
+    static void sortEvents(Array<StripEventRouter::Event> &blockEvents);
+
+    // Patterns only start / stop on the audio thread (as the notes are
+    // used there), calls from any other thread are queued up for it.
     void startPatternRecording();
     void stopPatternRecording();
 
+    // (position is in ticks)
     void startPatternPlaying(const int &position = 0);
     void resumePatternPlaying();
     void stopPatternPlaying();
 
+    // (audio thread) starts / stops anything that has been queued
+    void applyPendingCommands();
+
     // these are useful for giving visual feedback
     float getPatternPrecountPercent() const;
     float getPatternPercent() const;
 
+    /* Copies the recorded notes (in order) for the GUI. Returns false if
+       the audio thread was changing them, in which case try again later.
+    */
+    bool copyEvents(Array<PatternEvent> &dest) const;
+    // goes up whenever the notes change, so the GUI knows to redraw them
+    uint32 getChangeCount() const { return changeCount.get(); }
+
+    // notes that didn't fit (in the pattern or in a block)
+    int getNumDroppedEvents() const { return numDroppedEvents.get(); }
+    void resetNumDroppedEvents() { numDroppedEvents = 0; }
+
     // which pattern does this object represent
     const int slotID;
 
-    // MIDI ////////////////////
-    // this store the main pattern for playback
-    MidiBuffer midiPattern;
-    // Here we track each time we get a noteOn event. This
-    // way, at the end of the pattern we can fire noteOff
-    // events for any monome buttons that are held longer
-    // than the pattern
-    MidiBuffer noteOffs;
-
     // Properties /////////////////////////////////////////////
     bool isPatternRecording, isPatternPlaying;
     bool isPatternStopping;
     bool doesPatternLoop;
-    int patternLength, patternPrecountLength;
-    int patternLengthInSamples, patternPrecountLengthInSamples;
-    int patternPosition, patternPrecountPosition;
+    int patternLength, patternPrecountLength;       // in beats
+    int patternLengthInTicks, patternPrecountLengthInTicks;
+    double patternPosition, patternPrecountPosition; // (in ticks)
     int patternBank;
 
 private:
 
+    enum CommandType
+    {
+        cStartRecording,
+        cStopRecording,
+        cStartPlaying,
+        cResumePlaying,
+        cStopPlaying
+    };
+
+    struct Command
+    {
+        int type;
+        int position;   // (for cStartPlaying)
+    };
+
+    // applies the command now if we're on the audio thread, otherwise queues it
+    void queueCommand(const int &type, const int &position = 0);
+    void applyCommand(const Command &command);
+
+    void recordEvent(const MidiMessage &message, const int &position);
+    // adds the notes from startTick up to endTick, moving them so
+    // that startTick is blockOffset samples into the block
+    void addEventsInRange(Array<StripEventRouter::Event> &blockEvents,
+                          const double &startTick, const double &endTick,
+                          const double &blockOffset, const double &ticksPerSample,
+                          const int &numSamples);
+    // the note offs for every note that's been held, at this position
+    void addHeldNoteOffs(Array<StripEventRouter::Event> &blockEvents, const int &position);
+    // adds a note to the block, unless this pattern has used up its share
+    void addToBlock(Array<StripEventRouter::Event> &blockEvents, const StripEventRouter::Event &e);
+    // moves playback to this position (in ticks)
+    void seek(const double &position);
+    // re-seeks if the host is somewhere else in the pattern (e.g. it has looped)
+    void followHostPosition(const double &hostPositionInBeats);
+
+    // more than this far from the host (in ticks) and it must have jumped
+    enum { maxHostDrift = ticksPerBeat / 128 };
+
+    // Events ////////////////////
+    // the pattern itself (sorted by position)
+    Array<PatternEvent> events;
+    // Here we track each time we get a noteOn event. This
+    // way, at the end of the pattern we can fire noteOff
+    // events for any monome buttons that are held longer
+    // than the pattern
+    Array<PatternEvent> heldNotes;
+    // (see getChangeCount, this is odd while the notes are changing)
+    Atomic<uint32> changeCount;
+    Atomic<int> numDroppedEvents;
+    // how many notes playPattern has added to this block
+    int numBlockEvents;
+    // the next event to play, so each block starts where the last one stopped
+    int playbackIndex;
+    // how far into the block playback starts (when recording finishes mid-block)
+    int playbackOffset;
+    // the host's position (in beats) at the start of the pattern, if we know it
+    double hostStartPosition;
+    bool hasHostStart;
+
     // Communication ///////////////////
     mlrVSTAudioProcessor * const parent;
 
+    // starts / stops from other threads wait here for the audio thread
+    enum { commandQueueSize = 32 };
+    CriticalSection producerLock;
+    AbstractFifo commandFifo;
+    Command pendingCommands[commandQueueSize];
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PatternRecording);
 };
 
@@ -18,26 +18,25 @@ PatternStripControl::PatternStripControl(const int &patternID,
     patternData(patternLink),
     overlayPaintBounds(w, h),
     upperHalf(0, 0, w, h/2), lowerHalf(0, h/2, w, h/2),
-    notePositions(), noteColours()
+    lastChangeCount(patternLink->getChangeCount() - 1), cachedEvents(),
+    playbackPercent(0.0f), notePositions(), noteColours()
 {
-    patternData->addChangeListener(this);
 }
 
 PatternStripControl::~PatternStripControl()
 {
     notePositions.clear();
     noteColours.clear();
-    patternData->removeChangeListener(this);
 }
 
-void PatternStripControl::cachePattern()
+bool PatternStripControl::cachePattern()
 {
-    MidiBuffer::Iterator it(patternData->midiPattern);
-    MidiMessage result;
+    if (!patternData->copyEvents(cachedEvents))
+        return false;
 
-    const int lengthInSamples = patternData->patternLengthInSamples;
-    int samplePosition;
+    const Array<PatternRecording::PatternEvent> &events = cachedEvents;
 
+    const int lengthInTicks = patternData->patternLengthInTicks;
     int defaultVal = 0;
     Array<int> sampleOn(&defaultVal, 16);
 
@@ -46,16 +45,18 @@ void PatternStripControl::cachePattern()
 
     noteColours.clear(); notePositions.clear();
 
-    // loop through every MIDI event
-    while(it.getNextEvent(result, samplePosition))
+    // loop through every note
+    for (int i = 0; i < events.size(); ++i)
     {
-        const int chan = result.getChannel();
+        const PatternRecording::PatternEvent &e = events.getReference(i);
+        const int chan = e.channel;
+        const int samplePosition = e.position;
 
-        if (result.isNoteOn())
+        if (e.isNoteOn)
         {
             sampleOn.set(chan, samplePosition);
         }
-        else if (result.isNoteOff())
+        else
         {
             // if we have a note-on note-off pair, find the
             // difference between them in samples
@@ -63,8 +64,8 @@ void PatternStripControl::cachePattern()
 
             if (diff < 0) continue;
 
-            const float startX = width * ((float) sampleOn[chan] / (float) lengthInSamples);
-            const float noteWidth = width * (float)(diff) / (float) lengthInSamples;
+            const float startX = width * ((float) sampleOn[chan] / (float) lengthInTicks);
+            const float noteWidth = width * (float)(diff) / (float) lengthInTicks;
             const float startY = ((float) chan / 8.0f) * halfHeight + halfHeight;
             const float noteHeight = ((float) halfHeight / 8.0f);
 
@@ -72,23 +73,31 @@ void PatternStripControl::cachePattern()
             notePositions.add(Rectangle<float>(startX, startY, noteWidth, noteHeight));
 
             // set one past the end
-            sampleOn.set(chan, lengthInSamples + 1);
+            sampleOn.set(chan, lengthInTicks + 1);
         }
     }
+
+    return true;
 }
 
-void PatternStripControl::changeListenerCallback(ChangeBroadcaster * sender)
+void PatternStripControl::updateFromState(const GUIStateSnapshot::PatternState &state)
 {
-    // TODO: this potentially gets called a lot, maybe use timer?
-    if (sender == patternData)
-    {
-        // store copy of pattern for easy drawing
-        cachePattern();
+    bool needsRepaint = false;
 
-        // and redraw
-        repaint();
+    // store copy of pattern for easy drawing
+    if (state.changeCount != lastChangeCount && cachePattern())
+    {
+        lastChangeCount = state.changeCount;
+        needsRepaint = true;
+    }
 
+    if (state.percent != playbackPercent)
+    {
+        playbackPercent = state.percent;
+        needsRepaint = true;
     }
+
+    if (needsRepaint) repaint();
 }
 
 void PatternStripControl::paint(Graphics& g)
@@ -112,7 +121,7 @@ void PatternStripControl::paint(Graphics& g)
         g.fillRect(notePositions[i]);
     }
 
-    const float playbackPosX = overlayPaintBounds.getWidth() * patternData->getPatternPercent();
+    const float playbackPosX = overlayPaintBounds.getWidth() * playbackPercent;
 
     g.drawLine(playbackPosX, 0.0f, playbackPosX, (float) overlayPaintBounds.getHeight(), 1.0f);
 }
\ No newline at end of file
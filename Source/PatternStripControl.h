@@ -11,11 +11,11 @@ Author:  hemmer
 #ifndef __PATTERNOVERLAY_H_93085C1D__
 #define __PATTERNOVERLAY_H_93085C1D__
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 #include "mlrVSTGUI.h"
+#include "GUIStateSnapshot.h"
 
-class PatternStripControl : public Component,
-    public ChangeListener
+class PatternStripControl : public Component
 {
 
 public:
@@ -27,7 +27,8 @@ public:
 
     ~PatternStripControl();
 
-    void changeListenerCallback(ChangeBroadcaster * sender);
+    // (GUI thread) catches up with the pattern's state from the last snapshot
+    void updateFromState(const GUIStateSnapshot::PatternState &state);
 
     void paint(Graphics& g);
 
@@ -41,8 +42,14 @@ private:
     Rectangle<int> upperHalf, lowerHalf;
 
     // Store a visual copy of the Pattern so it doesn't
-    // need to be redrawn every call to paint()
-    void cachePattern();
+    // need to be redrawn every call to paint() (returns
+    // false if the pattern was changing, try again later)
+    bool cachePattern();
+    uint32 lastChangeCount;     // the pattern's change count when it was cached
+    // our copy of the notes (the audio thread may be recording the pattern's)
+    Array<PatternRecording::PatternEvent> cachedEvents;
+
+    float playbackPercent;
 
     // Cache note positions and colours
     Array<Rectangle<float> > notePositions;
@@ -0,0 +1,122 @@
+/*
+  ==============================================================================
+
+    PeakPyramid.cpp
+    Created: 18 Oct 2026 11:02:37pm
+    Author:  hemmer
+
+  ==============================================================================
+*/
+
+#include "PeakPyramid.h"
+
+PeakPyramid::PeakPyramid(const int &numChannelsToUse, const int &numFramesToUse) :
+    numChannels(numChannelsToUse), numFrames(numFramesToUse), levels()
+{
+    jassert(numChannels > 0 && numFrames > 0);
+
+    Level *finestLevel = levels.add(new Level());
+    finestLevel->numPeaks = 1 + (numFrames - 1) / framesPerPeak;
+    finestLevel->mins.calloc(numChannels * finestLevel->numPeaks);
+    finestLevel->maxs.calloc(numChannels * finestLevel->numPeaks);
+}
+
+PeakPyramid::~PeakPyramid()
+{
+}
+
+void PeakPyramid::addFrames(const float* const* channelData, const int &startFrame, const int &numFramesToAdd)
+{
+    jassert(startFrame % framesPerPeak == 0);
+    jassert(startFrame + numFramesToAdd <= numFrames);
+
+    Level &level = *levels.getUnchecked(0);
+    const int firstPeak = startFrame / framesPerPeak;
+
+    for (int c = 0; c < numChannels; ++c)
+    {
+        float *mins = level.mins + c * level.numPeaks + firstPeak;
+        float *maxs = level.maxs + c * level.numPeaks + firstPeak;
+
+        for (int offset = 0; offset < numFramesToAdd; offset += framesPerPeak)
+        {
+            // (this is vectorised by JUCE where it can be)
+            FloatVectorOperations::findMinAndMax(channelData[c] + offset,
+                                                 jmin((int) framesPerPeak, numFramesToAdd - offset),
+                                                 *mins++, *maxs++);
+        }
+    }
+}
+
+void PeakPyramid::buildLevels()
+{
+    // only the finest level should be there
+    levels.removeRange(1, levels.size() - 1);
+
+    // keep halving until there are just a few peaks left
+    while (levels.getLast()->numPeaks > 16)
+    {
+        const Level &finer = *levels.getLast();
+
+        Level *coarser = new Level();
+        coarser->numPeaks = (finer.numPeaks + 1) / 2;
+        coarser->mins.malloc(numChannels * coarser->numPeaks);
+        coarser->maxs.malloc(numChannels * coarser->numPeaks);
+
+        for (int c = 0; c < numChannels; ++c)
+        {
+            const float *finerMins = finer.mins + c * finer.numPeaks;
+            const float *finerMaxs = finer.maxs + c * finer.numPeaks;
+            float *mins = coarser->mins + c * coarser->numPeaks;
+            float *maxs = coarser->maxs + c * coarser->numPeaks;
+
+            for (int p = 0; p < coarser->numPeaks; ++p)
+            {
+                // the last peak may only have one to merge
+                const int second = jmin(2 * p + 1, finer.numPeaks - 1);
+                mins[p] = jmin(finerMins[2 * p], finerMins[second]);
+                maxs[p] = jmax(finerMaxs[2 * p], finerMaxs[second]);
+            }
+        }
+
+        levels.add(coarser);
+    }
+}
+
+void PeakPyramid::getPeaks(const int &channel, const int &startFrame, const int &endFrame,
+                           float *mins, float *maxs, const int &numPixels) const
+{
+    jassert(channel >= 0 && channel < numChannels);
+    jassert(numPixels > 0);
+
+    const double framesPerPixel = (endFrame - startFrame) / (double) numPixels;
+
+    // the coarsest level that still has a peak for every pixel
+    int l = 0;
+    while (l + 1 < levels.size() && (framesPerPeak << (l + 1)) <= framesPerPixel)
+        ++l;
+
+    const Level &level = *levels.getUnchecked(l);
+    const int framesPerLevelPeak = framesPerPeak << l;
+    const float *levelMins = level.mins + channel * level.numPeaks;
+    const float *levelMaxs = level.maxs + channel * level.numPeaks;
+
+    for (int i = 0; i < numPixels; ++i)
+    {
+        const int pixelStart = startFrame + (int) (i * framesPerPixel);
+        const int pixelEnd = startFrame + (int) ((i + 1) * framesPerPixel);
+
+        const int firstPeak = jlimit(0, level.numPeaks - 1, pixelStart / framesPerLevelPeak);
+        const int lastPeak = jlimit(firstPeak, level.numPeaks - 1, (pixelEnd - 1) / framesPerLevelPeak);
+
+        float mn = levelMins[firstPeak], mx = levelMaxs[firstPeak];
+        for (int p = firstPeak + 1; p <= lastPeak; ++p)
+        {
+            mn = jmin(mn, levelMins[p]);
+            mx = jmax(mx, levelMaxs[p]);
+        }
+
+        mins[i] = mn;
+        maxs[i] = mx;
+    }
+}
@@ -0,0 +1,65 @@
+/*
+  ==============================================================================
+
+    PeakPyramid.h
+    Created: 18 Oct 2026 11:02:37pm
+    Author:  hemmer
+
+    Min / max peaks of a sample at several resolutions. The finest level
+    has a peak for every framesPerPeak frames, and each level after that
+    halves the resolution, so drawing any part of the sample at any width
+    only has to look at a handful of peaks per pixel rather than rescanning
+    the audio.
+
+  ==============================================================================
+*/
+
+#ifndef PEAKPYRAMID_H_INCLUDED
+#define PEAKPYRAMID_H_INCLUDED
+
+#include "JuceHeader.h"
+
+
+class PeakPyramid
+{
+public:
+    PeakPyramid(const int &numChannels, const int &numFrames);
+    ~PeakPyramid();
+
+    enum { framesPerPeak = 64 };
+
+    int getNumChannels() const { return numChannels; }
+    int getNumFrames() const { return numFrames; }
+
+    /* Fills in the finest level for frames startFrame to startFrame +
+       numFramesToAdd (startFrame must be a multiple of framesPerPeak).
+       Different ranges can be added from different threads at once.
+    */
+    void addFrames(const float* const* channelData, const int &startFrame, const int &numFramesToAdd);
+
+    // once all the frames are added, works out the coarser levels
+    void buildLevels();
+
+    /* Finds the min / max for each of numPixels pixels spread evenly
+       between startFrame and endFrame, using the coarsest level that
+       still has at least one peak per pixel.
+    */
+    void getPeaks(const int &channel, const int &startFrame, const int &endFrame,
+                  float *mins, float *maxs, const int &numPixels) const;
+
+private:
+
+    struct Level
+    {
+        int numPeaks;
+        HeapBlock<float> mins, maxs;    // numPeaks for each channel in turn
+    };
+
+    const int numChannels, numFrames;
+    OwnedArray<Level> levels;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PeakPyramid);
+};
+
+
+#endif  // PEAKPYRAMID_H_INCLUDED
@@ -37,8 +37,7 @@ mlrVSTAudioProcessor::mlrVSTAudioProcessor() :
     gs(this),
 
     // MIDI / quantisation /////////////////////////////////////////
-    quantisationOn(false), quantisationGap(0), quantRemaining(0),
-    quantisedBuffer(), unquantisedCollector(),
+    pressTimer(), quantiseScheduler(),
     // Sample Pools ///////////////////////////
     samplePool(), resamplePool(), recordPool(),
     // Channel Setup ////////////////////////////////////////////////
@@ -48,23 +47,28 @@ mlrVSTAudioProcessor::mlrVSTAudioProcessor() :
     isBPMInc(false), isBPMDec(false),
 
     // Sample Strips //////////////////////
-    sampleStripArray(),
+    sampleStripArray(), audioThreadId(), lastProcessBlockTime(),
+    stripRenderPool(this),
+    profiler(), profileLogCountdown(0), lastLoggedOverruns(0),
+    traceRecorder(), traceDumpRequested(0), guiState(),
     // OSC /////////////////////////////////////////////
     oscMsgHandler(gs.OSCPrefix, this),
     // Audio / MIDI Buffers /////////////////////////////////////////
     stripContrib(2, 0),
-    resampleBuffer(2, 0), resampleLengthInSamples(0), resamplePrecountLengthInSamples(0),
-    resamplePosition(0), resamplePrecountPosition(0),
-    recordBuffer(2, 0), recordLengthInSamples(0), recordPrecountLengthInSamples(0),
-    recordPosition(0), recordPrecountPosition(0),
-    patternRecorder(),
+    captureThread("mlrVST capture starter"),
+    resampleCapture(captureThread, thumbnailBuilder), recordCapture(captureThread, thumbnailBuilder),
+    inputHistory(), outputHistory(),
+    patternRecorder(), patternEvents(), stripEventRouter(), sampleLoader(this),
+    sampleStreamThread("mlrVST sample streamer"), thumbnailBuilder(),
+    diskWriterThread("mlrVST disk writer"),
+    recordToDisk(diskWriterThread), resampleToDisk(diskWriterThread),
     // Preset handling /////////////////////////////////////////
     presetList("preset_list"), setlist("setlist"),
     // Mapping settings ////////////////////////////////////////
     mappingEngine(), currentStripModifier(-1),
     // Misc /////////////////////////////////////////////////////////
     buttonStatus(gs.numMonomeRows, gs.numMonomeCols, false),
-    playbackLEDPosition()
+    ledFrame(), framesSinceLEDRefresh(0)
 {
 
     // compile time assertions
@@ -84,19 +88,30 @@ mlrVSTAudioProcessor::mlrVSTAudioProcessor() :
 
     // TODO: have actual sample rate
     for (int i = 0; i < gs.resampleBankSize; ++i)
-        resamplePool.add(new AudioSample(44100.0, 44100, THUMBNAIL_WIDTH, "resample #" + String(i), AudioSample::tResampledSample));
+        resamplePool.add(new AudioSample(44100.0, 44100, "resample #" + String(i), AudioSample::tResampledSample));
     for (int i = 0; i < gs.recordBankSize; ++i)
-        recordPool.add(new AudioSample(44100.0, 44100, THUMBNAIL_WIDTH, "record #" + String(i), AudioSample::tRecordedSample));
+        recordPool.add(new AudioSample(44100.0, 44100, "record #" + String(i), AudioSample::tRecordedSample));
     for (int i = 0; i < gs.patternBankSize; ++i)
         patternRecordings.add(new PatternRecording(this, i));
 
     setlist.createNewChildElement("blank_preset");
 
+    // streamed samples need decoding before the audio thread gets there
+    sampleStreamThread.startThread(6);
+    // and recordings have their thumbnails made in the background
+    thumbnailBuilder.startThread(3);
+    // (and the record / resample buffers are got ready here)
+    captureThread.startThread(5);
+    // the disk needs to keep up with the audio when recording to it
+    diskWriterThread.startThread(6);
+
     lastPosInfo.resetToDefault();
 
-    // timer for re-drawing LEDs
-    const int ledRedrawIntervalInMillisecs = 100;
-    startTimer(ledRedrawIntervalInMillisecs);
+    // timer for tempo / volume changes etc
+    const int controlIntervalInMillisecs = 100;
+    startTimer(controlTimerID, controlIntervalInMillisecs);
+    // and for re-drawing LEDs
+    setLEDFrameRate(gs.ledFrameRate);
 
     // setup 2D arrays for tracking LED states
     setMonomeStatusGrids(8, 8);
@@ -104,6 +119,17 @@ mlrVSTAudioProcessor::mlrVSTAudioProcessor() :
 
 mlrVSTAudioProcessor::~mlrVSTAudioProcessor()
 {
+    // don't let any loads finish while we're shutting down
+    sampleLoader.cancelAll();
+    // or any thumbnails (they use the samples)
+    thumbnailBuilder.stopThread(4000);
+    // or any takes that are waiting to start
+    captureThread.stopThread(2000);
+    // finish off any recordings so they aren't lost
+    recordToDisk.stop();
+    resampleToDisk.stop();
+    diskWriterThread.stopThread(2000);
+
     // stop all sample strips
     AudioSample *nullSample = 0;
     for (int s = 0; s < gs.numSampleStrips; s++)
@@ -114,6 +140,8 @@ mlrVSTAudioProcessor::~mlrVSTAudioProcessor()
 
     // stop any sort of audio
     suspendProcessing(true);
+    // and make sure the strips have let go of their samples
+    flushSampleStripChanges();
 
     // be polite and turn off any remaining LEDs!
     oscMsgHandler.clearGrid();
@@ -123,6 +151,8 @@ mlrVSTAudioProcessor::~mlrVSTAudioProcessor()
 
     // unload samples from memory
     samplePool.clear(true);
+    // (the streamed ones needed this so it stops last)
+    sampleStreamThread.stopThread(2000);
     resamplePool.clear(true);
     recordPool.clear(true);
     patternRecordings.clear(true);
@@ -137,13 +167,11 @@ int mlrVSTAudioProcessor::addNewSample(File &sampleFile)
 {
 
     // if the sample already exists, return its (existing) index
-    for(int i = 0; i < samplePool.size(); ++i)
+    const int existingIndex = findSampleInPool(sampleFile);
+    if (existingIndex >= 0)
     {
-        if (samplePool[i]->getSampleFile() == sampleFile)
-        {
-            DBG("Sample already loaded!");
-            return i;
-        }
+        DBG("Sample already loaded!");
+        return existingIndex;
     }
 
     // use this to check that we are only loading audio files
@@ -157,12 +185,9 @@ int mlrVSTAudioProcessor::addNewSample(File &sampleFile)
 
     // otherwise try to load the Sample
     try{
-        // TODO: add actual length here
-        samplePool.add(new AudioSample(sampleFile, THUMBNAIL_WIDTH));
-        DBG("Sample Loaded: " + samplePool.getLast()->getSampleName());
-
-        // if it is sucessful, it will be the last sample in the pool
-        int newSampleIndex = samplePool.size() - 1;
+        const int newSampleIndex = addLoadedSample(new AudioSample(sampleFile, &thumbnailBuilder,
+                                                                   nullptr, &sampleStreamThread));
+        DBG("Sample Loaded: " + samplePool[newSampleIndex]->getSampleName());
         return newSampleIndex;
     }
     catch(String errString)
@@ -176,21 +201,61 @@ int mlrVSTAudioProcessor::addNewSample(File &sampleFile)
 
 }
 
-void mlrVSTAudioProcessor::setMonomeStatusGrids(const int &/*width*/, const int &height)
+int mlrVSTAudioProcessor::addLoadedSample(AudioSample *newSample)
 {
-    // ignore the top row (reserved for other things)
-    int effectiveHeight = height - 1;
+    jassert(newSample != nullptr);
+    ScopedPointer<AudioSample> sampleToAdd(newSample);
+
+    // the check and the add must happen together
+    const ScopedLock sl(samplePool.getLock());
 
-    // reset arrays
-    playbackLEDPosition.clear();
+    // someone else may have loaded this file in the meantime
+    const int existingIndex = findSampleInPool(sampleToAdd->getSampleFile());
+    if (existingIndex >= 0) return existingIndex;
 
-    for (int i = 0; i < effectiveHeight; ++i)
+    samplePool.add(sampleToAdd.release());
+    return samplePool.size() - 1;
+}
+
+int mlrVSTAudioProcessor::findSampleInPool(const File &sampleFile) const
+{
+    const ScopedLock sl(samplePool.getLock());
+
+    for (int i = 0; i < samplePool.size(); ++i)
     {
-        playbackLEDPosition.add(-1);
+        if (samplePool.getUnchecked(i)->getSampleFile() == sampleFile)
+            return i;
     }
 
+    return -1;
+}
+
+int64 mlrVSTAudioProcessor::getSamplePoolMemoryUsage() const
+{
+    const ScopedLock sl(samplePool.getLock());
+
+    int64 memoryUsage = 0;
+    for (int i = 0; i < samplePool.size(); ++i)
+        memoryUsage += samplePool.getUnchecked(i)->getMemoryUsage();
+
+    return memoryUsage;
+}
+
+void mlrVSTAudioProcessor::setMonomeStatusGrids(const int &/*width*/, const int &height)
+{
+    // (ignoring the top row, which is reserved for other things)
+    jassert(height - 1 < LEDFramebuffer::maxNumRows);
+
     // just in case, turn off any LEDs that might have been on!
     oscMsgHandler.clearGrid();
+    ledFrame.clear();
+    // (and send the whole of the next frame to the new size)
+    ledFrame.invalidate();
+}
+
+void mlrVSTAudioProcessor::setLEDFrameRate(const int &framesPerSecond)
+{
+    startTimer(ledFrameTimerID, 1000 / jmax(1, framesPerSecond));
 }
 
 void mlrVSTAudioProcessor::buildChannelArray()
@@ -205,6 +270,7 @@ void mlrVSTAudioProcessor::buildChannelArray()
 
     // make sure we're not doing any audio processing while (re)building it
     suspendProcessing(true);
+    flushSampleStripChanges();
 
 
     // reset the list of channels
@@ -232,22 +298,31 @@ void mlrVSTAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     // initialisation that you need..
 
     // clear the note buffers
-    unquantisedCollector.reset(sampleRate);
-    quantisedBuffer.clear();
+    pressTimer.reset();
+    quantiseScheduler.reset();
 
     updateQuantizeSettings();
 
     // this is not a completely accurate size as the block size may change with
     // time, but at least we can allocate roughly the right size:
     stripContrib.setSize(2, samplesPerBlock, false, true, false);
+    stripRenderPool.prepareToPlay(samplesPerBlock, sampleRate);
+    // a strip's notes can come from every pattern, the quantise queue and the host
+    patternEvents.ensureStorageAllocated(gs.patternBankSize * PatternRecording::maxEventsPerBlock);
+    stripEventRouter.prepare(sampleStripArray.size(), gs.maxChannels,
+                             gs.patternBankSize * PatternRecording::maxEventsPerBlock
+                             + QuantiseScheduler::maxNumTriggers + 128);
+
+    // so the first take doesn't have to allocate
+    reserveCaptureBuffers();
 }
 
 void mlrVSTAudioProcessor::releaseResources()
 {
     // When playback stops, you can use this as an opportunity to free up any
     // spare memory, etc.
-    quantisedBuffer.clear();
-    unquantisedCollector.reset(getSampleRate());
+    pressTimer.reset();
+    quantiseScheduler.reset();
 }
 
 void mlrVSTAudioProcessor::reset()
@@ -263,6 +338,19 @@ void mlrVSTAudioProcessor::processBlock(AudioSampleBuffer& buffer, MidiBuffer& m
 
     if (!isSuspended())
     {
+        profiler.startBlock(numSamples, getSampleRate());
+        int64 stageStart = ProcessProfiler::now();
+
+        // Any changes to the SampleStrips from other threads (GUI, OSC
+        // etc) are queued, so note which thread we're on and apply them.
+        const Thread::ThreadID thisThread = Thread::getCurrentThreadId();
+        if (audioThreadId.get() != thisThread)
+            audioThreadId = thisThread;
+        lastProcessBlockTime = Time::getMillisecondCounter();
+
+        for (int s = 0; s < sampleStripArray.size(); ++s)
+            sampleStripArray[s]->applyPendingChanges();
+
         // ask the host for the current time so we can display it...
         AudioPlayHead::CurrentPositionInfo newTime;
 
@@ -276,7 +364,9 @@ void mlrVSTAudioProcessor::processBlock(AudioSampleBuffer& buffer, MidiBuffer& m
 				const double newBPM = lastPosInfo.bpm;
 
 	            // If the tempo has changed, adjust the playspeeds accordingly
-                gs.setGlobalSetting(GlobalSettings::sCurrentBPM, &newBPM);
+                // (the GUI gets the new tempo from the state snapshot, as
+                // change messages can't be sent from the audio thread)
+                gs.setGlobalSetting(GlobalSettings::sCurrentBPM, &newBPM, false);
             }
         }
         else
@@ -287,88 +377,93 @@ void mlrVSTAudioProcessor::processBlock(AudioSampleBuffer& buffer, MidiBuffer& m
 
 
 
-        // if we are using the quantised buffer, dump all
-        // queued messages at the appropriate point
-        if (quantisationOn)
-        {
-            // if we are within range
-            if (quantRemaining < numSamples)
-            {
-                // ...and have data
-                if (!quantisedBuffer.isEmpty())
-                {
-                    // get the iterator for this buffer
-                    MidiBuffer::Iterator i( quantisedBuffer );
-                    MidiMessage message (0xf4, 0.0);
-                    int time;
-
-                    // dump any messages from it into the main MIDI message queue
-                    while(i.getNextEvent(message, time))
-                        midiMessages.addEvent(message, quantRemaining);
-
-                    // empty the queue as these notes are no longer needed
-                    quantisedBuffer.clear();
-                }
-
-                // finally, reset the quantisation counter
-                quantRemaining += quantisationGap;
-            }
+        // This adds the "live / realtime" OSC messages from the monome
+        // (where MIDI channel is row, note number is column). Each goes
+        // exactly one block after it was pressed, so the timing is tight.
+        pressTimer.startBlock(numSamples);
+        PressTimer::Press press;
+        int pressOffset;
 
-            // subtract this buffer's samples from the counter
-            quantRemaining -= numSamples;
-        }
-        else
+        while (pressTimer.getNextPress(press, pressOffset))
         {
-            // This adds the "live / realtime" OSC messages from the monome which
-            // have been converted to midi messages (where MIDI channel is row, note
-            // number is column).
-            unquantisedCollector.removeNextBlockOfMessages(midiMessages, numSamples);
+            // quantised presses can't go on a grid line before this point
+            if (press.isQuantised)
+                quantiseScheduler.addTrigger(press.channel, press.noteNumber, press.isNoteOn, pressOffset);
+            else
+                midiMessages.addEvent(press.isNoteOn ? MidiMessage::noteOn(press.channel, press.noteNumber, 1.0f)
+                                                     : MidiMessage::noteOff(press.channel, press.noteNumber),
+                                      pressOffset);
         }
 
+        // Quantised notes go on the next line(s) of the grid in this block,
+        // following the host's position when it's playing. (This also lets
+        // out anything left waiting when quantisation is turned off.)
+        const double samplesPerBeat = getSampleRate() * 60.0 / gs.currentBPM;
+        const bool followHost = gs.useExternalTempo && lastPosInfo.isPlaying;
+        quantiseScheduler.processBlock(midiMessages, numSamples, samplesPerBeat,
+                                       followHost ? &lastPosInfo.ppqPosition : nullptr);
+
+        profiler.stageDone(ProcessProfiler::stageEvents, stageStart);
+        stageStart = ProcessProfiler::now();
+
+        // patterns are timed in ticks, so follow any tempo change straight
+        // away (and when the host is playing, its position too)
+        const double patternTicksPerSample = PatternRecording::getTicksPerSample(gs.currentBPM, getSampleRate());
+        const double * const hostPosition = followHost ? &lastPosInfo.ppqPosition : nullptr;
 
         // use the pattern recorders (if recording)
         for (int b = 0; b < gs.patternBankSize; ++b)
-            patternRecordings[b]->recordPattern(midiMessages, numSamples);
+        {
+            patternRecordings[b]->applyPendingCommands();
+            patternRecordings[b]->recordPattern(midiMessages, numSamples, patternTicksPerSample, hostPosition);
+        }
 
         // and play back patterns (if playing back)
+        patternEvents.clearQuick();
         for (int b = 0; b < gs.patternBankSize; ++b)
-            patternRecordings[b]->playPattern(midiMessages, numSamples);
+            patternRecordings[b]->playPattern(patternEvents, numSamples, patternTicksPerSample, hostPosition);
+        // (each pattern's notes are in order, but not all of them together)
+        PatternRecording::sortEvents(patternEvents);
 
+        profiler.stageDone(ProcessProfiler::stagePatterns, stageStart);
+        stageStart = ProcessProfiler::now();
 
         // if we are recording from mlrVST's inputs
         if (gs.isRecording)
             processRecordingBuffer(buffer, numSamples);
+        // (this does nothing unless we're recording to disk)
+        recordToDisk.write(buffer, numSamples);
+        // always remember the last few bars in case they're wanted
+        inputHistory.write(buffer, numSamples);
 
+        profiler.stageDone(ProcessProfiler::stageCapture, stageStart);
+        stageStart = ProcessProfiler::now();
 
         // if we're aren't monitoring, clear any incoming audio
         if (!gs.monitorInputs) buffer.clear();
 
 
-        // make sure the buffer for SampleStrip contributions is
-        // *exactly* the right size and avoid reallocating if possible
-        stripContrib.setSize(2, numSamples, false, false, true);
+        // work out which notes belong to which strips
+        stripEventRouter.routeEvents(midiMessages, patternEvents, sampleStripArray);
 
-        for (int s = 0; s < sampleStripArray.size(); s++)
+        if (stripRenderPool.getNumThreads() > 1)
         {
-            sampleStripArray[s]->setBPM(gs.currentBPM);
-
-            // clear the contribution from the previous strip
-            stripContrib.clear();
-            // find this channels contribution
-            sampleStripArray[s]->renderNextBlock(stripContrib, midiMessages, 0, numSamples);
-
-            // get the associated channel so we can apply gain
-            const int stripChannel = *static_cast<const int *>(sampleStripArray[s]->getSampleStripParam(SampleStrip::pCurrentChannel));
+            // share the strips out between the render threads
+            stripRenderPool.renderStrips(buffer, stripEventRouter, sampleStripArray.size(), numSamples);
+        }
+        else
+        {
+            // make sure the buffer for SampleStrip contributions is
+            // *exactly* the right size and avoid reallocating if possible
+            stripContrib.setSize(2, numSamples, false, false, true);
 
-            // if this channel is NOT muted
-            if (!getChannelMuteStatus(stripChannel))
-            {
-                // add this contribution scaled by the channel gain
-                buffer.addFrom(0, 0, stripContrib, 0, 0, numSamples, getChannelGain(stripChannel) );
-                buffer.addFrom(1, 0, stripContrib, 1, 0, numSamples, getChannelGain(stripChannel) );
-            }
+            for (int s = 0; s < sampleStripArray.size(); s++)
+                renderSampleStrip(s, stripContrib, buffer, stripEventRouter, numSamples);
         }
 
+        profiler.stageDone(ProcessProfiler::stageStrips, stageStart);
+        stageStart = ProcessProfiler::now();
+
         // Go through the outgoing data, and apply our master gain to it...
         for (int channel = 0; channel < getNumInputChannels(); ++channel)
             buffer.applyGain(channel, 0, buffer.getNumSamples(), gs.masterGain);
@@ -380,9 +475,20 @@ void mlrVSTAudioProcessor::processBlock(AudioSampleBuffer& buffer, MidiBuffer& m
         for (int i = getNumInputChannels(); i < getNumOutputChannels(); ++i)
             buffer.clear(i, 0, buffer.getNumSamples());
 
+        profiler.stageDone(ProcessProfiler::stageMixing, stageStart);
+        stageStart = ProcessProfiler::now();
+
         // if we are resampling the audio that mlrVST is producing...
         if (gs.isResampling)
             processResamplingBuffer(buffer, numSamples);
+        resampleToDisk.write(buffer, numSamples);
+        outputHistory.write(buffer, numSamples);
+
+        // (this adds to the time for capturing the input)
+        profiler.stageDone(ProcessProfiler::stageCapture, stageStart);
+
+        publishGUIState();
+        profiler.endBlock(sampleStripArray.size());
 
     }
     else
@@ -396,8 +502,59 @@ void mlrVSTAudioProcessor::processBlock(AudioSampleBuffer& buffer, MidiBuffer& m
 // OSC Stuff        //
 //////////////////////
 
-void mlrVSTAudioProcessor::timerCallback()
+void mlrVSTAudioProcessor::timerCallback(int timerID)
 {
+    if (timerID == ledFrameTimerID)
+    {
+        drawLEDFrame();
+        return;
+    }
+
+    // if the host has stopped calling processBlock, nothing
+    // else will apply the queued SampleStrip changes
+    if (!isAudioRunning())
+        flushSampleStripChanges();
+
+    // log how processBlock is doing every 30s, or
+    // straight away if it has missed a deadline
+    const int profileLogInterval = 300;
+    if (--profileLogCountdown <= 0 || profiler.getNumOverruns() != lastLoggedOverruns)
+    {
+        Logger::writeToLog(profiler.getSummary(sampleStripArray.size()));
+        lastLoggedOverruns = profiler.getNumOverruns();
+        profileLogCountdown = profileLogInterval;
+    }
+
+    if (traceDumpRequested.compareAndSetBool(0, 1))
+        dumpTrace();
+
+    // a tempo change can make the longest take longer
+    reserveCaptureBuffers();
+
+    // long recordings are streamed back from disk rather than loaded
+    for (File recordedFile(recordToDisk.getNextFinishedFile()); recordedFile.existsAsFile();
+         recordedFile = recordToDisk.getNextFinishedFile())
+        loadSampleAsync(recordedFile);
+    for (File recordedFile(resampleToDisk.getNextFinishedFile()); recordedFile.existsAsFile();
+         recordedFile = resampleToDisk.getNextFinishedFile())
+        loadSampleAsync(recordedFile);
+
+    if (stripEventRouter.getNumDroppedEvents() > 0)
+    {
+        Logger::writeToLog("dropped " + String(stripEventRouter.getNumDroppedEvents()) + " strip events (too many in one block)");
+        stripEventRouter.resetNumDroppedEvents();
+    }
+
+    for (int p = 0; p < patternRecordings.size(); ++p)
+    {
+        PatternRecording * const pattern = patternRecordings.getUnchecked(p);
+
+        if (pattern->getNumDroppedEvents() > 0)
+        {
+            Logger::writeToLog("dropped " + String(pattern->getNumDroppedEvents()) + " notes from pattern " + String(p) + " (too many notes)");
+            pattern->resetNumDroppedEvents();
+        }
+    }
 
     /////////////////
     // Global updates
@@ -448,30 +605,32 @@ void mlrVSTAudioProcessor::timerCallback()
     // SampleStrip updates
     for (int row = 0; row < sampleStripArray.size(); ++row)
     {
+        SampleStrip * const strip = sampleStripArray.getUnchecked(row);
+
         // first if either of the modifier buttons are lifted...
         if (currentStripModifier != MappingEngine::rmSampleStripMappingA
             && currentStripModifier != MappingEngine::rmSampleStripMappingB)
         {
-            const bool stopIncsDecs = false;
-
-            // ...stop any vol/speed incs/decs
-            setSampleStripParameter(SampleStrip::pIsVolInc, &stopIncsDecs, row, false);
-            setSampleStripParameter(SampleStrip::pIsVolDec, &stopIncsDecs, row, false);
-            setSampleStripParameter(SampleStrip::pIsPlaySpeedInc, &stopIncsDecs, row, false);
-            setSampleStripParameter(SampleStrip::pIsPlaySpeedDec, &stopIncsDecs, row, false);
+            // ...stop any vol/speed incs/decs (these changes get queued
+            // for the audio thread, so only send the ones needed)
+            if (strip->getSampleStripParam<SampleStrip::pIsVolInc>())
+                strip->setSampleStripParam<SampleStrip::pIsVolInc>(false, false);
+            if (strip->getSampleStripParam<SampleStrip::pIsVolDec>())
+                strip->setSampleStripParam<SampleStrip::pIsVolDec>(false, false);
+            if (strip->getSampleStripParam<SampleStrip::pIsPlaySpeedInc>())
+                strip->setSampleStripParam<SampleStrip::pIsPlaySpeedInc>(false, false);
+            if (strip->getSampleStripParam<SampleStrip::pIsPlaySpeedDec>())
+                strip->setSampleStripParam<SampleStrip::pIsPlaySpeedDec>(false, false);
         }
 
 
 
-        const bool isVolInc = *static_cast<const bool*>
-            (getSampleStripParameter(SampleStrip::pIsVolInc, row));
-        const bool isVolDec = *static_cast<const bool*>
-            (getSampleStripParameter(SampleStrip::pIsVolDec, row));
+        const bool isVolInc = strip->getSampleStripParam<SampleStrip::pIsVolInc>();
+        const bool isVolDec = strip->getSampleStripParam<SampleStrip::pIsVolDec>();
 
         if (isVolInc)
         {
-            float stripVol = *static_cast<const float*>
-                (getSampleStripParameter(SampleStrip::pStripVolume, row));
+            float stripVol = strip->getSampleStripParam<SampleStrip::pStripVolume>();
 
             stripVol += 0.05f;
 
@@ -479,93 +638,85 @@ void mlrVSTAudioProcessor::timerCallback()
             if (stripVol > 4.0f)
             {
                 stripVol = 4.0f;
-                toggleSampleStripParameter(SampleStrip::pIsVolInc, row);
+                strip->toggleSampleStripParam(SampleStrip::pIsVolInc);
             }
 
-            setSampleStripParameter(SampleStrip::pStripVolume, &stripVol, row);
+            strip->setSampleStripParam<SampleStrip::pStripVolume>(stripVol);
 
         }
         else if (isVolDec)
         {
-            float stripVol = *static_cast<const float*>
-                (getSampleStripParameter(SampleStrip::pStripVolume, row));
+            float stripVol = strip->getSampleStripParam<SampleStrip::pStripVolume>();
             stripVol -= 0.05f;
 
             // stop increasing once we reach a max value
             if (stripVol < 0.0)
             {
                 stripVol = 0.0;
-                toggleSampleStripParameter(SampleStrip::pIsVolDec, row);
+                strip->toggleSampleStripParam(SampleStrip::pIsVolDec);
             }
 
-            setSampleStripParameter(SampleStrip::pStripVolume, &stripVol, row);
+            strip->setSampleStripParam<SampleStrip::pStripVolume>(stripVol);
 
         }
 
 
-        const bool isSpeedInc = *static_cast<const bool*>
-            (getSampleStripParameter(SampleStrip::pIsPlaySpeedInc, row));
-        const bool isSpeedDec = *static_cast<const bool*>
-            (getSampleStripParameter(SampleStrip::pIsPlaySpeedDec, row));
+        const bool isSpeedInc = strip->getSampleStripParam<SampleStrip::pIsPlaySpeedInc>();
+        const bool isSpeedDec = strip->getSampleStripParam<SampleStrip::pIsPlaySpeedDec>();
 
 
         if (isSpeedInc)
         {
-            double stripPlaySpeed = *static_cast<const double*>
-                (getSampleStripParameter(SampleStrip::pPlaySpeed, row));
+            double stripPlaySpeed = strip->getSampleStripParam<SampleStrip::pPlaySpeed>();
             stripPlaySpeed += 0.01;
-            setSampleStripParameter(SampleStrip::pPlaySpeed, &stripPlaySpeed, row);
+            strip->setSampleStripParam<SampleStrip::pPlaySpeed>(stripPlaySpeed);
 
         }
 
         else if (isSpeedDec)
         {
-            double stripPlaySpeed = *static_cast<const double*>
-                (getSampleStripParameter(SampleStrip::pPlaySpeed, row));
+            double stripPlaySpeed = strip->getSampleStripParam<SampleStrip::pPlaySpeed>();
             stripPlaySpeed -= 0.01;
-            setSampleStripParameter(SampleStrip::pPlaySpeed, &stripPlaySpeed, row);
+            strip->setSampleStripParam<SampleStrip::pPlaySpeed>(stripPlaySpeed);
 
         }
+    }
+}
 
+void mlrVSTAudioProcessor::drawLEDFrame()
+{
+    // the top row is reserved for other things
+    for (int row = 0; row < sampleStripArray.size(); ++row)
+    {
+        const SampleStrip * const strip = sampleStripArray.getUnchecked(row);
 
-        // TODO: this is still a pretty horrendous way to do this
-        // and will be updated to use led/row once I have it
-        // working with the new OSC spec!
-        const bool isPlaying = *static_cast<const bool*>
-            (getSampleStripParameter(SampleStrip::pIsPlaying, row));
+        // start with the row blank (stopped strips stay that way)...
+        ledFrame.setRow(row + 1, false);
 
-        if (isPlaying)
+        if (strip->getSampleStripParam<SampleStrip::pIsPlaying>())
         {
-            float percentage = *static_cast<const float*>
-                (getSampleStripParameter(SampleStrip::pPlaybackPercentage, row));
-            int numChunks = *static_cast<const int*>
-                (getSampleStripParameter(SampleStrip::pNumChunks, row));
+            const float percentage = strip->getSampleStripParam<SampleStrip::pPlaybackPercentage>();
+            const int numChunks = strip->getSampleStripParam<SampleStrip::pNumChunks>();
 
-            // this is basically the x-coord of the LED to turn on
-            int fractionalPosition = (int)(percentage * numChunks);
-
-            // if the LED has changed then...
-            if (playbackLEDPosition[row] != fractionalPosition)
-            {
-                // ...move the LED along to the new position
-                oscMsgHandler.setLED(fractionalPosition, row + 1, 1);
-                oscMsgHandler.setLED(playbackLEDPosition[row], row + 1, 0);
-                // and store the new playback point
-                playbackLEDPosition.set(row, fractionalPosition);
-            }
+            // ...and light the LED under the playback position
+            ledFrame.setLED((int) (percentage * numChunks), row + 1, true);
         }
-        else
-        {
-            // if we're not playing, make sure the row is blank
-            oscMsgHandler.setRow(row + 1, 0);
+    }
 
-            // sanity check more than anything
-            playbackLEDPosition.set(row, -1);
-        }
+    // Resend everything every second or so, in case any messages were
+    // lost (it's UDP) or the device was reconnected without us knowing.
+    if (++framesSinceLEDRefresh >= gs.ledFrameRate)
+    {
+        ledFrame.invalidate();
+        framesSinceLEDRefresh = 0;
     }
+
+    // only the rows which changed are sent
+    oscMsgHandler.sendLEDFrame(ledFrame, gs.numMonomeRows, gs.numMonomeCols);
 }
 
-void mlrVSTAudioProcessor::processOSCKeyPress(const int &monomeCol, const int &monomeRow, const bool &state)
+void mlrVSTAudioProcessor::processOSCKeyPress(const int &monomeCol, const int &monomeRow, const bool &state,
+                                              const int &sampleOffset)
 {
     // filter out any keypresses outside the allowed range of the device
     if (monomeRow < 0 || monomeCol < 0) return;
@@ -613,10 +764,13 @@ void mlrVSTAudioProcessor::processOSCKeyPress(const int &monomeCol, const int &m
                 currentStripModifier = (state) ? MappingEngine::rmGlobalMapping : MappingEngine::rmNoBtn;
                 break;
             }
-        case MappingEngine::tmStartRecording : startRecording(); break;
-        case MappingEngine::tmStartResampling : startResampling(); break;
+        // (these only happen when the button is pressed, not released)
+        case MappingEngine::tmStartRecording : if (state) startRecording(); break;
+        case MappingEngine::tmStartResampling : if (state) startResampling(); break;
         case MappingEngine::tmStopAll : stopAllStrips(SampleStrip::mStopNormal); break;
         case MappingEngine::tmTapeStopAll : stopAllStrips(SampleStrip::mStopTape); break;
+        case MappingEngine::tmKeepLastRecording : if (state) keepLastRecording(); break;
+        case MappingEngine::tmKeepLastResampling : if (state) keepLastResampling(); break;
         default : jassertfalse;
         }
 
@@ -696,58 +850,20 @@ void mlrVSTAudioProcessor::processOSCKeyPress(const int &monomeCol, const int &m
            numChunks too to filter these.
         */
 
-        const int numChunks = *static_cast<const int*>
-            (sampleStripArray[stripID]->getSampleStripParam(SampleStrip::pNumChunks));
+        const int numChunks = sampleStripArray[stripID]->getSampleStripParam<SampleStrip::pNumChunks>();
 
         // ditch anything outside this range
         if (monomeCol >= numChunks) return;
 
 
-        // button pressed down
-        if (state)
-        {
-            if (quantisationOn)
-            {
-                // If we are quantising, create an on message and store it it the queue -
-                // then once the quantised interval (of length quantisationGap) has
-                // elapsed (i.e. quantisation remaining < 0) we can fire in all the messages
-                // at once!
-
-                // NOTE: The +1 here is because midi channels start at 1 not 0!
-                MidiMessage quantisedMessage(MidiMessage::noteOn(stripID + 1, monomeCol, 1.0f), 0.01);
-                quantisedBuffer.addEvent(quantisedMessage, 0);
-            }
-
-            else
-            {
-                // NOTE: The +1 here is because midi channels start at 1 not 0!
-                MidiMessage unquantisedMessage(MidiMessage::noteOn(stripID + 1, monomeCol, 1.0f), 0.01);
+        // Queue the press (down or up) with the time it happened (or the
+        // offset we were given). If we are quantising it is then played on
+        // the next line of the quantisation grid, otherwise at the same
+        // point in the next block.
 
-                const double stamp = juce::Time::getMillisecondCounterHiRes() / 1000.0;
-                unquantisedMessage.setTimeStamp(stamp);
-                unquantisedCollector.addMessageToQueue(unquantisedMessage);
-            }
-        }
-
-        // button released
-        else
-        {
-            if (quantisationOn)
-            {
-                // NOTE: The +1 here is because midi channels start at 1 not 0!
-                MidiMessage quantisedMessage(MidiMessage::noteOff(stripID + 1, monomeCol), 0.01);
-                quantisedBuffer.addEvent(quantisedMessage, 0);
-            }
-            else
-            {
-                // NOTE: The +1 here is because midi channels start at 1 not 0!
-                MidiMessage unquantisedMessage(MidiMessage::noteOff(stripID + 1, monomeCol), 0.01);
-
-                const double stamp = juce::Time::getMillisecondCounterHiRes() / 1000.0;
-                unquantisedMessage.setTimeStamp(stamp);
-                unquantisedCollector.addMessageToQueue(unquantisedMessage);
-            }
-        }
+        // NOTE: The +1 here is because midi channels start at 1 not 0!
+        pressTimer.addPress(stripID + 1, monomeCol, state, quantiseScheduler.isQuantising(), sampleOffset);
+        traceRecorder.record(TraceRecorder::evPressQueued, stripID, monomeCol);
     }
 }
 
@@ -838,6 +954,92 @@ SampleStrip* mlrVSTAudioProcessor::getSampleStrip(const int &index)
     return sampleStripArray[index];
 }
 
+void mlrVSTAudioProcessor::renderSampleStrip(const int &stripID, AudioSampleBuffer &stripBuffer, AudioSampleBuffer &output,
+                                             const StripEventRouter &events, const int &numSamples)
+{
+    const int64 renderStart = ProcessProfiler::now();
+    SampleStrip * const strip = sampleStripArray.getUnchecked(stripID);
+
+    strip->setBPM(gs.currentBPM);
+
+    // clear the contribution from the previous strip
+    stripBuffer.clear();
+    // find this channels contribution
+    strip->renderNextBlock(stripBuffer, events, 0, numSamples);
+
+    // get the associated channel so we can apply gain
+    const int stripChannel = strip->getSampleStripParam<SampleStrip::pCurrentChannel>();
+
+    // if this channel is NOT muted
+    if (!getChannelMuteStatus(stripChannel))
+    {
+        // add this contribution scaled by the channel gain
+        const float channelGain = getChannelGain(stripChannel);
+        output.addFrom(0, 0, stripBuffer, 0, 0, numSamples, channelGain);
+        output.addFrom(1, 0, stripBuffer, 1, 0, numSamples, channelGain);
+    }
+
+    profiler.stripDone(stripID, renderStart);
+}
+
+void mlrVSTAudioProcessor::flushSampleStripChanges()
+{
+    // stop the audio thread running while we pretend to be it
+    const ScopedLock sl (getCallbackLock());
+
+    const Thread::ThreadID previousAudioThread = audioThreadId.get();
+    audioThreadId = Thread::getCurrentThreadId();
+
+    for (int s = 0; s < sampleStripArray.size(); ++s)
+        sampleStripArray[s]->applyPendingChanges();
+
+    // (the GUI won't see these otherwise)
+    publishGUIState();
+
+    audioThreadId = previousAudioThread;
+}
+
+void mlrVSTAudioProcessor::publishGUIState()
+{
+    GUIStateSnapshot::State &state = guiState.getStateToWrite();
+
+    state.numStrips = jmin(sampleStripArray.size(), (int) GUIStateSnapshot::maxNumStrips);
+    for (int s = 0; s < state.numStrips; ++s)
+    {
+        const SampleStrip * const strip = sampleStripArray.getUnchecked(s);
+        GUIStateSnapshot::StripState &stripState = state.strips[s];
+
+        stripState.isPlaying = strip->getSampleStripParam<SampleStrip::pIsPlaying>();
+        stripState.playbackPercentage = strip->getSampleStripParam<SampleStrip::pPlaybackPercentage>();
+        stripState.changeCount = strip->getChangeCount();
+    }
+
+    state.numPatterns = jmin(patternRecordings.size(), (int) GUIStateSnapshot::maxNumPatterns);
+    state.currentPatternBank = gs.currentPatternBank;
+    for (int p = 0; p < state.numPatterns; ++p)
+    {
+        const PatternRecording * const pattern = patternRecordings.getUnchecked(p);
+        GUIStateSnapshot::PatternState &patternState = state.patterns[p];
+
+        patternState.isRecording = pattern->isPatternRecording;
+        patternState.isPlaying = pattern->isPatternPlaying;
+        patternState.precountPercent = pattern->getPatternPrecountPercent();
+        patternState.percent = pattern->getPatternPercent();
+        patternState.changeCount = pattern->getChangeCount();
+    }
+
+    state.isRecording = areWeRecording();
+    state.recordPrecountPercent = getRecordingPrecountPercent();
+    state.recordPercent = getRecordingPercent();
+    state.isResampling = areWeResampling();
+    state.resamplePrecountPercent = getResamplingPrecountPercent();
+    state.resamplePercent = getResamplingPercent();
+
+    state.currentBPM = gs.currentBPM;
+
+    guiState.publish();
+}
+
 void mlrVSTAudioProcessor::switchChannels(const int &newChan, const int &stripID)
 {
     // Let the strip now about the new channel
@@ -866,7 +1068,29 @@ bool mlrVSTAudioProcessor::loadXmlSetlist(const File &setlistFile)
     DBG("Loading setlist: " << setlistFile.getFullPathName());
 
     XmlDocument setlistToLoad(setlistFile);
-    return Preset::loadSetlist(setlistToLoad.getDocumentElement(), this, &gs);
+    ScopedPointer<XmlElement> setlistElement(setlistToLoad.getDocumentElement());
+    if (setlistElement == nullptr) return false;
+
+    // whatever was being prefetched for the old setlist can wait
+    sampleLoader.cancelPrefetches();
+
+    return Preset::loadSetlist(setlistElement, this, &gs);
+}
+
+void mlrVSTAudioProcessor::prefetchSetlistSamples()
+{
+    Array<File> sampleFiles;
+
+    forEachXmlChildElement(setlist, setlistItem)
+        Preset::getSampleFiles(setlistItem, sampleFiles);
+
+    prefetchSamples(sampleFiles);
+}
+
+void mlrVSTAudioProcessor::prefetchSamples(const Array<File> &sampleFiles)
+{
+    const int64 memoryBudget = (int64) getGlobalSetting<GlobalSettings::sSampleMemoryBudget>() * 1024 * 1024;
+    sampleLoader.prefetchSamples(sampleFiles, memoryBudget);
 }
 
 void mlrVSTAudioProcessor::createNewPreset(const String &newPresetName)
@@ -960,6 +1184,9 @@ void mlrVSTAudioProcessor::insetPresetIntoSetlist(const int &presetID, const int
     if (presetID >= 0 && presetID < presetListLength)
     {
         setlist.insertChildElement(new XmlElement(*(presetList.getChildElement(presetID))), indexToInsertAt);
+
+        // get its samples ready
+        prefetchSetlistSamples();
     }
 }
 
@@ -969,163 +1196,222 @@ void mlrVSTAudioProcessor::insetPresetIntoSetlist(const int &presetID, const int
 // RECORDING / RESAMPLING //
 ////////////////////////////
 
+int mlrVSTAudioProcessor::getCaptureLengthInSamples(const int &lengthInBeats) const
+{
+    return (int) (getSampleRate() * (60.0 * lengthInBeats / gs.currentBPM));
+}
+
+void mlrVSTAudioProcessor::reserveCaptureBuffers()
+{
+    // (these don't do anything while a take is in progress)
+    resampleCapture.reserve(getCaptureLengthInSamples(gs.resampleLength));
+    recordCapture.reserve(getCaptureLengthInSamples(gs.recordLength));
+
+    // only keep as much history as a take could use
+    inputHistory.prepare(getSampleRate(), getCaptureLengthInSamples(gs.recordLength));
+    outputHistory.prepare(getSampleRate(), getCaptureLengthInSamples(gs.resampleLength));
+}
+
+void mlrVSTAudioProcessor::toggleDiskRecording(DiskRecorder &recorder, const String &takeName)
+{
+    if (recorder.isRecording())
+    {
+        // finishing the file can take a while, so the writer thread
+        // does it and the timer loads it once it's done
+        recorder.stopInBackground();
+    }
+    else
+    {
+        const File recordingsFolder(File::getSpecialLocation(File::userDocumentsDirectory)
+                                    .getChildFile("mlrVST recordings"));
+        const File newFile(recordingsFolder.getNonexistentChildFile(
+                               takeName + Time::getCurrentTime().formatted(" %Y-%m-%d %H-%M-%S"),
+                               DiskRecorder::getFileExtension(gs.diskRecordFormat), false));
+
+        if (!recorder.start(newFile, gs.diskRecordFormat, getSampleRate()))
+        {
+            DBG("couldn't start recording to " << newFile.getFullPathName());
+        }
+    }
+}
+
+float mlrVSTAudioProcessor::getDiskRecordingPercent(const DiskRecorder &recorder, const int &lengthInBeats) const
+{
+    const double lengthInSeconds = 60.0 * lengthInBeats / gs.currentBPM;
+    if (lengthInSeconds <= 0.0) return 0.0;
+
+    const double secondsRecorded = recorder.getSecondsRecorded();
+    return (float) ((secondsRecorded - lengthInSeconds * floor(secondsRecorded / lengthInSeconds)) / lengthInSeconds);
+}
+
+File mlrVSTAudioProcessor::dumpTrace()
+{
+    const File tracesFolder(File::getSpecialLocation(File::userDocumentsDirectory)
+                            .getChildFile("mlrVST traces"));
+    tracesFolder.createDirectory();
+
+    const File traceFile(tracesFolder.getNonexistentChildFile(
+                             "trace" + Time::getCurrentTime().formatted(" %Y-%m-%d %H-%M-%S"), ".json", false));
+
+    if (!traceRecorder.writeChromeTrace(traceFile, audioThreadId.get()))
+    {
+        Logger::writeToLog("couldn't write trace to " + traceFile.getFullPathName());
+        return File::nonexistent;
+    }
+
+    Logger::writeToLog("trace written to " + traceFile.getFullPathName());
+    return traceFile;
+}
+
 void mlrVSTAudioProcessor::startResampling()
 {
-    resampleLengthInSamples = (int) (getSampleRate() * (60.0 * gs.resampleLength / gs.currentBPM));
-    resamplePrecountLengthInSamples = (int) (getSampleRate() * (60.0 * gs.resamplePrecountLength / gs.currentBPM));
-    resamplePrecountPosition = resamplePrecountLengthInSamples;
+    // recording to disk has no length, so the button starts / stops it
+    if (resampleToDisk.isRecording() || gs.diskRecordFormat != DiskRecorder::formatNone)
+    {
+        toggleDiskRecording(resampleToDisk, "resample");
+        return;
+    }
 
-    // TODO: try writing directly into the bank
-    //resamplePool[resampleBank]->
-    //resampleBuffer = resamplePool[resampleBank]->getAudioData();
+    const int resampleLengthInSamples = getCaptureLengthInSamples(gs.resampleLength);
+    if (resampleLengthInSamples <= 0) return;
 
-    resampleBuffer.setSize(2, resampleLengthInSamples, false, true);
-    resampleBuffer.clear();
-    resamplePosition = 0;
-    gs.isResampling = true;
+    // (this only queues the take, the capture thread starts it once
+    // the thumbnail builder has let go of the buffer it reuses)
+    if (resampleCapture.start(resamplePool[gs.resampleBank], resampleLengthInSamples,
+                              getCaptureLengthInSamples(gs.resamplePrecountLength)))
+    {
+        gs.isResampling = true;
+        traceRecorder.record(TraceRecorder::evCaptureStart, 1, gs.resampleBank);
+        DBG("resampling started");
+    }
+}
+void mlrVSTAudioProcessor::keepLastResampling()
+{
+    const int resampleLengthInSamples = jmin(getCaptureLengthInSamples(gs.resampleLength),
+                                             outputHistory.getMaxReadLength());
+    if (resampleLengthInSamples <= 0) return;
 
-    DBG("resampling started");
+    // (the capture thread makes the copy, then the
+    // audio thread just swaps it in on the next block)
+    if (resampleCapture.startFromHistory(resamplePool[gs.resampleBank], outputHistory, resampleLengthInSamples))
+    {
+        gs.isResampling = true;
+        traceRecorder.record(TraceRecorder::evCaptureStart, 1, gs.resampleBank);
+    }
+    else
+    {
+        DBG("couldn't keep the last resampling");
+    }
 }
 float mlrVSTAudioProcessor::getResamplingPrecountPercent() const
 {
-    if (resamplePrecountPosition <= 0 || resamplePrecountLengthInSamples <= 0)
-        return 0.0;
-    else
-        return (float) (resamplePrecountPosition) / (float) (resamplePrecountLengthInSamples);
+    return resampleCapture.getPrecountPercent();
 }
 float mlrVSTAudioProcessor::getResamplingPercent() const
 {
-    if (resamplePosition >= resampleLengthInSamples || resampleLengthInSamples <= 0)
-        return 0.0;
-    else
-        return (float) (resamplePosition) / (float) (resampleLengthInSamples);
+    if (resampleToDisk.isRecording())
+        return getDiskRecordingPercent(resampleToDisk, gs.resampleLength);
+
+    return resampleCapture.getPercent();
 }
 void mlrVSTAudioProcessor::processResamplingBuffer(AudioSampleBuffer &buffer, const int &numSamples)
 {
-    // if we are still during the precount, do nothing
-    if (resamplePrecountPosition > 0)
-        // TODO: this sample count could be more accurate!
-        resamplePrecountPosition -= numSamples;
-
-    else
+    // if this finished the take then the slot already has the new audio
+    if (resampleCapture.process(buffer, numSamples, getSampleRate()))
     {
-        // if we are during recording (and not near the end), just
-        // add the current input into the record buffer
-        if (numSamples + resamplePosition < resampleLengthInSamples)
-        {
-            resampleBuffer.addFrom(0, resamplePosition, buffer, 0, 0, numSamples);
-            resampleBuffer.addFrom(1, resamplePosition, buffer, 1, 0, numSamples);
-            resamplePosition += numSamples;
-        }
+        // we are no longer recording
+        gs.isResampling = false;
+        traceRecorder.record(TraceRecorder::evCaptureFinish, 1);
 
-        // otherwise we are finishing up and we need to store the results
-        // in an AudioSample object
-        else
-        {
-            const int samplesToEnd = resampleLengthInSamples - resamplePosition;
-            // add the remaining samples
-            resampleBuffer.addFrom(0, resamplePosition, buffer, 0, 0, samplesToEnd);
-            resampleBuffer.addFrom(1, resamplePosition, buffer, 1, 0, samplesToEnd);
-            // we are no longer recording
-            gs.isResampling = false;
-
-            // get the pointer to the slot in the resample bank that we want to replace
-            AudioSampleBuffer *resampleSlotToReplace = resamplePool[gs.resampleBank]->getAudioData();
-            // and resize it in case the length has changed
-            resampleSlotToReplace->setSize(2, resampleLengthInSamples, false, false, false);
-            // copy in the newly recorded samples
-            resampleSlotToReplace->copyFrom(0, 0, resampleBuffer, 0, 0, resampleLengthInSamples);
-            resampleSlotToReplace->copyFrom(1, 0, resampleBuffer, 1, 0, resampleLengthInSamples);
-            // and update the thumbnail
-            resamplePool[gs.resampleBank]->generateThumbnail(THUMBNAIL_WIDTH);
-
-            // this is just so buttons can work out that it's finished
-            resamplePosition += samplesToEnd;
-
-            DBG("resample slot " << gs.resampleBank << " updated.");
-
-            // make sure all SampleStrips redraw to reflect new waveform
-            for (int s = 0; s < sampleStripArray.size(); ++s)
-                sampleStripArray[s]->sendChangeMessage();
-        }
+        // and update the thumbnail (in the background)
+        thumbnailBuilder.requestRebuild(resampleCapture.getTargetSample());
+
+        DBG("resample slot updated.");
+
+        // make sure all SampleStrips redraw to reflect new waveform
+        for (int s = 0; s < sampleStripArray.size(); ++s)
+            sampleStripArray[s]->markChanged();
+    }
+    else if (!resampleCapture.isCapturing())
+    {
+        // the take was dropped before it started (see keepLastResampling)
+        gs.isResampling = false;
     }
 }
 
 void mlrVSTAudioProcessor::startRecording()
 {
-    recordLengthInSamples = (int) (getSampleRate() * (60.0 * gs.recordLength / gs.currentBPM));
-    recordPrecountLengthInSamples = (int) (getSampleRate() * (60.0 * gs.recordPrecountLength / gs.currentBPM));
-    recordPrecountPosition = recordPrecountLengthInSamples;
+    // recording to disk has no length, so the button starts / stops it
+    if (recordToDisk.isRecording() || gs.diskRecordFormat != DiskRecorder::formatNone)
+    {
+        toggleDiskRecording(recordToDisk, "record");
+        return;
+    }
 
-    recordBuffer.setSize(2, recordLengthInSamples, false, true);
-    recordBuffer.clear();
-    recordPosition = 0;
-    gs.isRecording = true;
+    const int recordLengthInSamples = getCaptureLengthInSamples(gs.recordLength);
+    if (recordLengthInSamples <= 0) return;
 
-    DBG("recording started");
+    // (this only queues the take, the capture thread starts it once
+    // the thumbnail builder has let go of the buffer it reuses)
+    if (recordCapture.start(recordPool[gs.recordBank], recordLengthInSamples,
+                            getCaptureLengthInSamples(gs.recordPrecountLength)))
+    {
+        gs.isRecording = true;
+        traceRecorder.record(TraceRecorder::evCaptureStart, 0, gs.recordBank);
+        DBG("recording started");
+    }
 }
-float mlrVSTAudioProcessor::getRecordingPrecountPercent() const
+void mlrVSTAudioProcessor::keepLastRecording()
 {
-    if (recordPrecountPosition <= 0 || recordPrecountLengthInSamples <= 0)
-        return 0.0;
+    const int recordLengthInSamples = jmin(getCaptureLengthInSamples(gs.recordLength),
+                                           inputHistory.getMaxReadLength());
+    if (recordLengthInSamples <= 0) return;
+
+    // (the capture thread makes the copy, then the
+    // audio thread just swaps it in on the next block)
+    if (recordCapture.startFromHistory(recordPool[gs.recordBank], inputHistory, recordLengthInSamples))
+    {
+        gs.isRecording = true;
+        traceRecorder.record(TraceRecorder::evCaptureStart, 0, gs.recordBank);
+    }
     else
-        return (float) (recordPrecountPosition) / (float) (recordPrecountLengthInSamples);
+    {
+        DBG("couldn't keep the last recording");
+    }
+}
+float mlrVSTAudioProcessor::getRecordingPrecountPercent() const
+{
+    return recordCapture.getPrecountPercent();
 }
 float mlrVSTAudioProcessor::getRecordingPercent() const
 {
-    if (recordPosition >= recordLengthInSamples || recordLengthInSamples <= 0)
-        return 0.0;
-    else
-        return (float) (recordPosition) / (float) (recordLengthInSamples);
+    if (recordToDisk.isRecording())
+        return getDiskRecordingPercent(recordToDisk, gs.recordLength);
+
+    return recordCapture.getPercent();
 }
 void mlrVSTAudioProcessor::processRecordingBuffer(AudioSampleBuffer &buffer, const int &numSamples)
 {
-    // if we are still during the precount, do nothing
-    if (recordPrecountPosition > 0)
-        // TODO: this sample count could be more accurate!
-        recordPrecountPosition -= numSamples;
-
-    else
+    // if this finished the take then the slot already has the new audio
+    if (recordCapture.process(buffer, numSamples, getSampleRate()))
     {
-        // if we are during recording (and not near the end), just
-        // add the current input into the record buffer
-        if (numSamples + recordPosition < recordLengthInSamples)
-        {
-            recordBuffer.addFrom(0, recordPosition, buffer, 0, 0, numSamples);
-            recordBuffer.addFrom(1, recordPosition, buffer, 1, 0, numSamples);
-            recordPosition += numSamples;
-        }
+        // we are no longer recording
+        gs.isRecording = false;
+        traceRecorder.record(TraceRecorder::evCaptureFinish, 0);
 
-        // otherwise we are finishing up and we need to store the results
-        // in an AudioSample object
-        else
-        {
-            const int samplesToEnd = recordLengthInSamples - recordPosition;
-            // add the remaining samples
-            recordBuffer.addFrom(0, recordPosition, buffer, 0, 0, samplesToEnd);
-            recordBuffer.addFrom(1, recordPosition, buffer, 1, 0, samplesToEnd);
-            // we are no longer recording
-            gs.isRecording = false;
-
-            // get the pointer to the slot in the record bank that we want to replace
-            AudioSampleBuffer *recordSlotToReplace = recordPool[gs.recordBank]->getAudioData();
-            // and resize it in case the length has changed
-            recordSlotToReplace->setSize(2, recordLengthInSamples, false, false, false);
-            // copy in the newly recorded samples
-            recordSlotToReplace->copyFrom(0, 0, recordBuffer, 0, 0, recordLengthInSamples);
-            recordSlotToReplace->copyFrom(1, 0, recordBuffer, 1, 0, recordLengthInSamples);
-            // and update the thumbnail
-            recordPool[gs.recordBank]->generateThumbnail(THUMBNAIL_WIDTH);
-
-            DBG("record slot " << gs.recordBank << " updated.");
-
-            // this is just so the TimedButtons can work out that recording has finished
-            recordPosition += samplesToEnd;
-
-            // make sure all SampleStrips redraw to reflect new waveform
-            for (int s = 0; s < gs.numSampleStrips; ++s)
-                sampleStripArray[s]->sendChangeMessage();
-        }
+        // and update the thumbnail (in the background)
+        thumbnailBuilder.requestRebuild(recordCapture.getTargetSample());
+
+        DBG("record slot updated.");
+
+        // make sure all SampleStrips redraw to reflect new waveform
+        for (int s = 0; s < gs.numSampleStrips; ++s)
+            sampleStripArray[s]->markChanged();
+    }
+    else if (!recordCapture.isCapturing())
+    {
+        // the take was dropped before it started (see keepLastRecording)
+        gs.isRecording = false;
     }
 }
 
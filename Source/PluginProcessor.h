@@ -15,7 +15,7 @@
 #define NUM_ROWS 8
 #define NUM_COLS 8
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 #include "AudioSample.h"
 #include "OSCHandler.h"
 #include "PatternRecording.h"
@@ -23,13 +23,25 @@
 #include "Array2D.h"
 #include "MappingEngine.h"
 #include "GlobalSettings.h"
+#include "StripRenderPool.h"
+#include "SampleLoader.h"
+#include "ThumbnailBuilder.h"
+#include "SampleCapture.h"
+#include "DiskRecorder.h"
+#include "CaptureHistory.h"
+#include "QuantiseScheduler.h"
+#include "PressTimer.h"
+#include "LEDFramebuffer.h"
+#include "ProcessProfiler.h"
+#include "TraceRecorder.h"
+#include "GUIStateSnapshot.h"
 
 class GlobalSettings;
 
 //==============================================================================
 class mlrVSTAudioProcessor : public AudioProcessor,
                              public ChangeBroadcaster,
-                             public Timer
+                             public MultiTimer
 {
 public:
     //==============================================================================
@@ -82,7 +94,11 @@ public:
     // callback - the UI component will read this and display it.
     AudioPlayHead::CurrentPositionInfo lastPosInfo;
 
-    void timerCallback();
+    // the controls (tempo / volume changes etc) and
+    // the monome's LEDs are updated on separate timers
+    enum TimerIDs { controlTimerID, ledFrameTimerID };
+    void timerCallback(int timerID);
+    void setLEDFrameRate(const int &framesPerSecond);
 
     // If we were to have any VST parameters, they would be listed here
     // however all mapping is self-contained so totalNumParams = 0
@@ -115,8 +131,31 @@ public:
 
 
 
-    // adds a sample to the sample pool
+    // adds a sample to the sample pool (this blocks while the file loads)
     int addNewSample(File &sampleFile);
+    // Loads the sample on a background thread instead, optionally giving
+    // it to a strip once it has loaded (see SampleLoader).
+    bool loadSampleAsync(const File &sampleFile, const int &targetStripID = -1)
+    {
+        return sampleLoader.loadSample(sampleFile, targetStripID);
+    }
+    // stops earlier loads from changing any strip's sample
+    void cancelStripSampleLoads() { sampleLoader.cancelStripLoads(); }
+    // how many samples are still waiting to load (queued or loading)
+    int getNumPendingSampleLoads() const { return sampleLoader.getNumPendingLoads(); }
+    void addSampleLoaderListener(SampleLoader::Listener *listener) { sampleLoader.addListener(listener); }
+    void removeSampleLoaderListener(SampleLoader::Listener *listener) { sampleLoader.removeListener(listener); }
+    // Takes ownership of a fully loaded sample and adds it to the pool, returning
+    // its index. If the file is already in the pool the new copy is deleted and the
+    // existing index returned. Safe to call from any thread.
+    int addLoadedSample(AudioSample *newSample);
+    // returns -1 if this file isn't in the sample pool
+    int findSampleInPool(const File &sampleFile) const;
+    // total memory used by the audio in the sample pool (in bytes)
+    int64 getSamplePoolMemoryUsage() const;
+    // shared by all the samples that are streamed from disk
+    TimeSliceThread* getSampleStreamThread() { return &sampleStreamThread; }
+    ThumbnailBuilder* getThumbnailBuilder() { return &thumbnailBuilder; }
     AudioSample * getAudioSample(const int &samplePoolIndex, const int &poolID);
     int getSamplePoolSize(const int &index) const
     {
@@ -163,8 +202,19 @@ public:
     void switchChannels(const int &newChan, const int &stripID);
     void stopAllStrips(const int &stopMode);
 
-    void processOSCKeyPress(const int &monomeCol, const int &monomeRow, const bool &state);
-    void setOSCPrefix(const String &newPrefix){ oscMsgHandler.setPrefix(newPrefix); }
+    /* Handles a press from the monome. Strip presses are normally timed
+       against the audio clock, but can be given the sample in the next
+       block they belong at instead (e.g. when rendering offline, where
+       there is no real clock to time them against).
+    */
+    void processOSCKeyPress(const int &monomeCol, const int &monomeRow, const bool &state,
+                            const int &sampleOffset = -1);
+    void setOSCPrefix(const String &newPrefix)
+    {
+        oscMsgHandler.setPrefix(newPrefix);
+        // (this is probably a different device, so it needs everything)
+        ledFrame.invalidate();
+    }
 
     // set up the channels (can be used to change number of channels
     void buildChannelArray();
@@ -172,10 +222,35 @@ public:
 
     SampleStrip* getSampleStrip(const int &index);
 
+    // SampleStrips only change their state on the audio thread,
+    // calls from any other thread are queued up for it instead
+    bool isAudioThread() const
+    {
+        return Thread::getCurrentThreadId() == audioThreadId.get()
+               || stripRenderPool.isWorkerThread();
+    }
+    // Has processBlock been called recently? If not, nothing will
+    // collect queued strip changes so they are flushed straight away.
+    bool isAudioRunning() const
+    {
+        return audioThreadId.get() != nullptr
+               && Time::getMillisecondCounter() - lastProcessBlockTime.get() <= (uint32) audioIdleTimeout;
+    }
+    // applies any queued changes now (blocking the audio callback)
+    void flushSampleStripChanges();
+
+    // Renders a single strip (using stripBuffer as scratch space) and adds it
+    // to output with its channel gain. This may be called from the render
+    // pool's worker threads, so must only touch that strip.
+    void renderSampleStrip(const int &stripID, AudioSampleBuffer &stripBuffer, AudioSampleBuffer &output,
+                           const StripEventRouter &events, const int &numSamples);
+    // how many threads are used to render the strips (1 is just the audio thread)
+    void setNumRenderThreads(const int &newNumThreads) { stripRenderPool.setNumThreads(newNumThreads); }
+
     bool getChannelMuteStatus(const int &chan) const
     {
-        const bool status = *static_cast<const bool*>(gs.getGlobalSettingArray(GlobalSettings::sChannelMutes, chan));
-        return status;
+        // (out of range channels are unmuted)
+        return gs.getGlobalSetting<GlobalSettings::sChannelMutes>()[chan];
     }
     void setChannelMute(const int &chan, const bool &state)
     {
@@ -183,8 +258,8 @@ public:
     }
     float getChannelGain(const int &chan) const
     {
-        const float gain = *static_cast<const float*>(gs.getGlobalSettingArray(GlobalSettings::sChannelGains, chan));
-        return gain;
+        // (out of range channels are silent)
+        return gs.getGlobalSetting<GlobalSettings::sChannelGains>()[chan];
     }
     void setChannelGain(const int &chan, const float &newGain)
     {
@@ -202,7 +277,7 @@ public:
         // for classes which don't have direct access to SampleStrips
         // e.g. the Preset class
         if (sampleStripID < sampleStripArray.size() && sampleStripID >= 0)
-            sampleStripArray[sampleStripID]->sendChangeMessage();
+            sampleStripArray[sampleStripID]->markChanged();
     }
     void setSampleStripParameter(const int &parameterID, const void *newValue, const int &stripID, const bool sendChangeMsg = true)
     {
@@ -226,6 +301,12 @@ public:
     // don't need access to the gs Settings engine
     const void* getGlobalSetting(const int &settingID) const;
     void setGlobalSetting(const int &settingID, const void * newValue, const bool &notifyListeners = true);
+    // typed version, e.g. getGlobalSetting<GlobalSettings::sNumMonomeCols>()
+    template <int settingID>
+    const typename GlobalSettingInfo<settingID>::Type& getGlobalSetting() const
+    {
+        return gs.getGlobalSetting<settingID>();
+    }
 
 
     // Preset stuff
@@ -252,20 +333,49 @@ public:
 
     XmlElement getSetlist() const { return setlist; }
     XmlElement & getSetlistP() { return setlist; }
-    void setSetlist(const XmlElement &newSetlist) { setlist = newSetlist; }
+    void setSetlist(const XmlElement &newSetlist) { setlist = newSetlist; prefetchSetlistSamples(); }
+
+    // Loads every sample used in the setlist in the background (in setlist
+    // order, until the sample_memory_budget is reached) so that switching
+    // between presets doesn't have to wait for files to load.
+    void prefetchSetlistSamples();
+    void prefetchSamples(const Array<File> &sampleFiles);
 
     // Recording / resampling stuff
     void startRecording();
     float getRecordingPrecountPercent() const;
     float getRecordingPercent() const;
     void processRecordingBuffer(AudioSampleBuffer &input, const int &numSamples);
-    bool areWeRecording() const { return gs.isRecording; }
+    bool areWeRecording() const { return gs.isRecording || recordToDisk.isRecording(); }
+    // puts the last recordLength of the inputs in the record slot right away
+    void keepLastRecording();
 
     void startResampling();
     float getResamplingPrecountPercent() const;
     float getResamplingPercent() const;
     void processResamplingBuffer(AudioSampleBuffer &input, const int &numSamples);
-    bool areWeResampling() const { return gs.isResampling; }
+    bool areWeResampling() const { return gs.isResampling || resampleToDisk.isRecording(); }
+    // same, but with the last resampleLength of mlrVST's output
+    void keepLastResampling();
+
+    // how long each stage of processBlock / each strip takes (for the GUI etc)
+    const ProcessProfiler& getProfiler() const { return profiler; }
+    void resetProfilerPeaks() { profiler.resetPeaks(); }
+
+    // (GUI thread) what the GUI draws from, see GUIStateSnapshot::update()
+    GUIStateSnapshot& getGUIState() { return guiState; }
+
+    // where presses, notes, takes etc are logged (from any thread)
+    TraceRecorder& getTraceRecorder() { return traceRecorder; }
+    // writes the trace to "mlrVST traces" in the user's documents,
+    // returning the file (or File::nonexistent if it failed)
+    File dumpTrace();
+    // (any thread) asks the control timer to call dumpTrace()
+    void requestTraceDump() { traceDumpRequested = 1; }
+
+    // gets the spare record / resample buffers big enough for the
+    // current lengths so that starting a take doesn't allocate
+    void reserveCaptureBuffers();
 
     void startPatternRecording() { patternRecordings[gs.currentPatternBank]->startPatternRecording(); }
     float getPatternPrecountPercent() const { return patternRecordings[gs.currentPatternBank]->getPatternPrecountPercent(); }
@@ -292,17 +402,8 @@ public:
     // note quantisation, quantisationLevel = 0.03125 etc
     void updateQuantizeSettings()
     {
-        if (gs.quantisationLevel < 0.0)
-        {
-            quantisationOn = false;
-            quantisedBuffer.clear();
-        }
-        else
-        {
-            quantisationGap = (int) (getSampleRate() * (120.0 * gs.quantisationLevel / gs.currentBPM));
-            quantRemaining = quantisationGap;
-            quantisationOn = true;
-        }
+        // (the grid is in beats, so this doesn't depend on the tempo)
+        quantiseScheduler.setGridLength((gs.quantisationLevel < 0.0) ? 0.0 : 2.0 * gs.quantisationLevel);
     }
 
     // this should be called if the BPM changes at all
@@ -343,17 +444,15 @@ private:
     // quantisationLevel stores the fineness of the quantisation
     // so that 1/4 note quantisation is 0.25 etc. NOTE: any negative
     // values will be interpreted as no quantisation (-1.0 preferred).
-    bool quantisationOn;
-    int quantisationGap, quantRemaining;
-
-    // quantised notes are stored in one buffer per strip
-    MidiBuffer quantisedBuffer;
-    // unquantised notes are collected all together
-    MidiMessageCollector unquantisedCollector;
+    // every press goes through here to be timed...
+    PressTimer pressTimer;
+    // ...and then here if it's quantised
+    QuantiseScheduler quantiseScheduler;
 
 
     // Sample Pools /////////////////////
-    OwnedArray<AudioSample> samplePool;         // for sample files (.wavs etc)
+    // (this is locked as the SampleLoader adds to it from its own thread)
+    OwnedArray<AudioSample, CriticalSection> samplePool;    // for sample files (.wavs etc)
     OwnedArray<AudioSample> resamplePool;       // for recorded internal sounds
     OwnedArray<AudioSample> recordPool;         // for external recordings
     OwnedArray<PatternRecording> patternRecordings;   // for pattern recordings
@@ -377,6 +476,30 @@ private:
     // SampleStripControl). They control the audio for each strip
     OwnedArray<SampleStrip> sampleStripArray;
 
+    // the thread currently running processBlock...
+    Atomic<Thread::ThreadID> audioThreadId;
+    // ...and when it last did so (in ms), so that if the host stops
+    // calling processBlock the queued strip changes still get applied
+    Atomic<uint32> lastProcessBlockTime;
+    enum { audioIdleTimeout = 250 };    // (ms)
+
+    // if enabled, this spreads the strips across several threads
+    StripRenderPool stripRenderPool;
+
+    // times each stage of processBlock...
+    ProcessProfiler profiler;
+    // ...which is logged every so often (and after any overrun)
+    int profileLogCountdown, lastLoggedOverruns;
+
+    // the last few thousand events, for chrome://tracing
+    TraceRecorder traceRecorder;
+    Atomic<int> traceDumpRequested;
+
+    // the strip / pattern / transport state is handed to the GUI
+    // through this (once per block), rather than by change messages
+    GUIStateSnapshot guiState;
+    void publishGUIState();
+
 
     // OSC ////////////////////////
     OSCHandler oscMsgHandler;   // Send and receive OSC messages through this
@@ -384,14 +507,32 @@ private:
     // Audio Buffers /////////////////
     // this is for summing the contributions from SampleStrips
     AudioSampleBuffer stripContrib;
-    // Store resampled information
-    AudioSampleBuffer resampleBuffer;
-    // Store recorded information
-    AudioSampleBuffer recordBuffer;
+    // Record takes straight into spare buffers which are then swapped
+    // into the record / resample pools (the thread gets them ready)
+    TimeSliceThread captureThread;
+    SampleCapture resampleCapture;
+    SampleCapture recordCapture;
+    // the last few bars of the inputs / output (for keepLastRecording etc)
+    CaptureHistory inputHistory, outputHistory;
 
     // Pattern recorder information
     MidiBuffer patternRecorder;
 
+    // this block's notes from the patterns (merged with the MIDI by the router)
+    Array<StripEventRouter::Event> patternEvents;
+    // this block's notes, sorted by strip / channel
+    StripEventRouter stripEventRouter;
+
+    // loads samples in the background
+    SampleLoader sampleLoader;
+    // and decodes any long samples which are streamed (see SampleStream)
+    TimeSliceThread sampleStreamThread;
+    // makes the sample thumbnails
+    ThumbnailBuilder thumbnailBuilder;
+    // writes record / resample takes to disk (if disk_record_format is set)
+    TimeSliceThread diskWriterThread;
+    DiskRecorder recordToDisk, resampleToDisk;
+
 
 
 
@@ -420,20 +561,25 @@ private:
     void executeGlobalMapping(const int &mappingID, const bool &state);
 
 
-    int recordLengthInSamples, recordPrecountLengthInSamples;
-    int recordPosition, recordPrecountPosition;
+    // how many samples a take of this many beats lasts at the current tempo
+    int getCaptureLengthInSamples(const int &lengthInBeats) const;
 
-    int resampleLengthInSamples, resamplePrecountLengthInSamples;   // length in samples
-    int resamplePosition, resamplePrecountPosition;     // track resampling progress
+    // Starts recording to a new file in the recordings folder or, if we
+    // already are, finishes the file and loads it into the sample pool.
+    void toggleDiskRecording(DiskRecorder &recorder, const String &takeName);
+    // when recording to disk the buttons just loop through each take length
+    float getDiskRecordingPercent(const DiskRecorder &recorder, const int &lengthInBeats) const;
 
     // Misc ////////////////
 
 
     Array2D<bool> buttonStatus;
 
-    // Store which LED column is currently being used
-    // for displaying playback position.
-    Array<int> playbackLEDPosition;
+    // What the monome's LEDs should be showing (only the
+    // changes are sent each frame, see drawLEDFrame).
+    LEDFramebuffer ledFrame;
+    int framesSinceLEDRefresh;  // (everything is resent every so often)
+    void drawLEDFrame();
 
 
 
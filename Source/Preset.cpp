@@ -10,6 +10,7 @@
 
 #include "Preset.h"
 #include "SampleStrip.h"
+#include "RenderKernels.h"
 #include "GlobalSettings.h"
 
 
@@ -183,6 +184,10 @@ bool Preset::loadPreset(XmlElement * presetToLoad,
 
     DBG(presetToLoad->createDocument(String::empty));
 
+    // Samples still loading for the old preset mustn't replace the new
+    // one's, even on strips where this preset doesn't have a sample.
+    processor->cancelStripSampleLoads();
+
     if (presetToLoad->getTagName() == "preset_none")
     {
         // we have a blank preset: loadDefaultPreset();
@@ -246,6 +251,14 @@ bool Preset::loadPreset(XmlElement * presetToLoad,
                 // and check it is valid
                 if (stripID > gs->numSampleStrips || stripID < 0) continue;
 
+                // presets from before there was a choice of interpolation
+                // should sound the same as they did (i.e. linear)
+                if (!elem->hasAttribute(SampleStrip::getParameterName(SampleStrip::pInterpolation)))
+                {
+                    const int linear = RenderKernels::iLinear;
+                    processor->setSampleStripParameter(SampleStrip::pInterpolation, &linear, stripID, false);
+                }
+
                 const int numAttribs = elem->getNumAttributes();
                 for (int i = 0; i < numAttribs; ++i)
                 {
@@ -289,19 +302,11 @@ bool Preset::loadPreset(XmlElement * presetToLoad,
                     case SampleStrip::TypeAudioSample :
                         {
                             const String filePath = sampleStripParamVal;
-                            File newFile = File(filePath);
-
-                            // add the sample and get the id
-                            const int sampleID = processor->addNewSample(newFile);
+                            const File newFile = File(filePath);
 
-                            // continue if loading failed
-                            if (sampleID == 0) continue;
-
-                            const AudioSample * newSample = processor->getAudioSample(sampleID, mlrVSTAudioProcessor::pSamplePool);
-
-                            // if the sample loaded correctly, set it to be the strip's AudioSample
-                            if (newSample)
-                                processor->setSampleStripParameter(SampleStrip::pAudioSample, newSample, stripID, false);
+                            // The sample is loaded in the background and given to the
+                            // strip when it's ready (this is instant if already loaded).
+                            processor->loadSampleAsync(newFile, stripID);
                         }
                     } // end switch statement
 
@@ -389,6 +394,13 @@ bool Preset::loadSetlist(XmlElement * setlistToLoad,
     processor->clearSetlist();
     processor->clearPresetList();
 
+    // Start loading every sample the setlist uses up front, in order, so
+    // they are (hopefully) ready by the time each preset is needed.
+    Array<File> sampleFiles;
+    forEachXmlChildElementWithTagName(*setlistToLoad, presetToPrefetch, "preset")
+        getSampleFiles(presetToPrefetch, sampleFiles);
+    processor->prefetchSamples(sampleFiles);
+
     // loop over each preset in the setlist
     forEachXmlChildElementWithTagName(*setlistToLoad, presetToLoad, "preset")
     {
@@ -404,5 +416,20 @@ bool Preset::loadSetlist(XmlElement * setlistToLoad,
 
     }
 
-    return false;
-}
\ No newline at end of file
+    return true;
+}
+
+void Preset::getSampleFiles(const XmlElement * preset, Array<File> &sampleFiles)
+{
+    if (preset == nullptr || preset->getTagName() != "preset") return;
+
+    const String sampleParamName = SampleStrip::getParameterName(SampleStrip::pAudioSample);
+
+    forEachXmlChildElementWithTagName(*preset, strip, "strip")
+    {
+        const String filePath = strip->getStringAttribute(sampleParamName);
+
+        if (filePath.isNotEmpty())
+            sampleFiles.addIfNotAlreadyThere(File(filePath));
+    }
+}
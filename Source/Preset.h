@@ -14,7 +14,7 @@
 #ifndef PRESET_H_INCLUDED
 #define PRESET_H_INCLUDED
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 #include "PluginProcessor.h"
 #include "GlobalSettings.h"
 
@@ -42,6 +42,10 @@ public:
                             mlrVSTAudioProcessor * processor,
                             GlobalSettings *gs);
 
+    // Adds the files of any samples the preset uses to sampleFiles
+    // (in strip order, without duplicates).
+    static void getSampleFiles(const XmlElement * preset, Array<File> &sampleFiles);
+
 private:
 
      JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Preset);
@@ -11,7 +11,7 @@
 #ifndef __PRESETLISTTABLE_H_6F0B8E4A__
 #define __PRESETLISTTABLE_H_6F0B8E4A__
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 
 class mlrVSTAudioProcessor;
 
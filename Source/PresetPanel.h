@@ -11,7 +11,7 @@
 #ifndef __PRESETWINDOW_H_F0BDFA0B__
 #define __PRESETWINDOW_H_F0BDFA0B__
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 #include "PresetListTable.h"
 #include "SetlistTable.h"
 
@@ -0,0 +1,131 @@
+/*
+  ==============================================================================
+
+    PressTimer.cpp
+    Created: 19 Oct 2026 2:41:26am
+    Author:  hemmer
+
+  ==============================================================================
+*/
+
+#include "PressTimer.h"
+#include <cmath>
+
+PressTimer::PressTimer() :
+    incomingFifo(maxNumPresses),
+    blockStartTime(0.0), nextBlockTime(0.0), secondsPerSample(0.0),
+    blockSize(0), latencyInSamples(0), clockRunning(false)
+{
+}
+
+bool PressTimer::addPress(const int &channel, const int &noteNumber, const bool &isNoteOn,
+                          const bool &isQuantised, const int &sampleOffset)
+{
+    int start1, size1, start2, size2;
+    incomingFifo.prepareToWrite(1, start1, size1, start2, size2);
+
+    if (size1 + size2 < 1)
+        return false;
+
+    Press &p = incoming[size1 > 0 ? start1 : start2];
+    p.channel = channel;
+    p.noteNumber = noteNumber;
+    p.isNoteOn = isNoteOn;
+    p.isQuantised = isQuantised;
+    p.time = Time::getMillisecondCounterHiRes() / 1000.0;
+    p.sampleOffset = sampleOffset;
+
+    incomingFifo.finishedWrite(1);
+    return true;
+}
+
+void PressTimer::startBlock(const int &numSamples)
+{
+    const double now = Time::getMillisecondCounterHiRes() / 1000.0;
+    const int previousBlockSize = blockSize;
+
+    blockSize = numSamples;
+    latencyInSamples = jmax(latencyInSamples, numSamples);
+
+    // Start the loop again if the host stops calling us for a while
+    // (it's easier than following the jump). A change of block size
+    // is fine, the next block is just expected that much later.
+    if (!clockRunning || previousBlockSize <= 0
+        || (secondsPerSample > 0.0
+            && fabs(now - nextBlockTime) > 4.0 * secondsPerSample * jmax(previousBlockSize, numSamples)))
+    {
+        blockStartTime = now;
+        secondsPerSample = 0.0;
+        clockRunning = true;
+        return;
+    }
+
+    if (secondsPerSample <= 0.0)
+    {
+        // This is the second block, so we have a first guess at the
+        // period (from the host's timing, as the sample rate may not
+        // be what the sound card is really running at).
+        secondsPerSample = jmax(1.0e-7, (now - blockStartTime) / previousBlockSize);
+        blockStartTime = now;
+        nextBlockTime = now + secondsPerSample * numSamples;
+        return;
+    }
+
+    // how far out our prediction was (after the last block)
+    const double error = now - nextBlockTime;
+
+    // a second order loop with a bandwidth of about 1Hz (the gains
+    // depend on how long the block the error came from was)
+    const double omega = 2.0 * double_Pi * 1.0 * secondsPerSample * previousBlockSize;
+
+    blockStartTime = nextBlockTime;
+    nextBlockTime += sqrt(2.0) * omega * error + secondsPerSample * numSamples;
+    secondsPerSample += omega * omega * error / previousBlockSize;
+}
+
+bool PressTimer::getNextPress(Press &press, int &sampleOffset)
+{
+    int start1, size1, start2, size2;
+    incomingFifo.prepareToRead(1, start1, size1, start2, size2);
+
+    if (size1 + size2 < 1)
+        return false;
+
+    const Press &p = incoming[size1 > 0 ? start1 : start2];
+
+    if (p.sampleOffset >= 0)
+    {
+        // we were told where it goes
+        sampleOffset = jlimit(0, jmax(0, blockSize - 1), p.sampleOffset);
+    }
+    else if (secondsPerSample <= 0.0)
+    {
+        // until the clock settles, just play presses straight away
+        sampleOffset = 0;
+    }
+    else
+    {
+        // A press goes latencyInSamples after it was made. Anything
+        // from before then is late, so goes at the start.
+        const double position = (p.time - blockStartTime) / secondsPerSample + latencyInSamples;
+
+        // it's due in a later block, so leave it for then
+        if (position >= blockSize)
+            return false;
+
+        sampleOffset = jlimit(0, blockSize - 1, (int) position);
+    }
+
+    press = p;
+    incomingFifo.finishedRead(1);
+    return true;
+}
+
+void PressTimer::reset()
+{
+    incomingFifo.reset();
+    secondsPerSample = 0.0;
+    blockSize = 0;
+    latencyInSamples = 0;
+    clockRunning = false;
+}
@@ -0,0 +1,89 @@
+/*
+  ==============================================================================
+
+    PressTimer.h
+    Created: 19 Oct 2026 2:41:26am
+    Author:  hemmer
+
+    Works out where in the audio each monome press belongs. The audio
+    callbacks arrive at jittery times, so the time each block starts is
+    smoothed (with a delay-locked loop on the sample count) into a steady
+    clock. A press made at time t is then played exactly one (longest)
+    block later than t on that clock. This means every press has the same
+    latency, rather than anything between zero and one block depending on
+    when it arrived relative to the callback. Hosts which vary the block
+    size are fine, as the clock runs in seconds per sample.
+
+  ==============================================================================
+*/
+
+#ifndef PRESSTIMER_H_INCLUDED
+#define PRESSTIMER_H_INCLUDED
+
+#include "JuceHeader.h"
+
+
+class PressTimer
+{
+public:
+    PressTimer();
+
+    enum { maxNumPresses = 256 };  // presses that can be waiting at once
+
+    struct Press
+    {
+        int channel, noteNumber;
+        bool isNoteOn;
+        bool isQuantised;   // goes to the QuantiseScheduler rather than straight out
+        double time;        // when it was received (in seconds)
+        int sampleOffset;   // where it goes in the next block, or -1 to time it
+    };
+
+    /* (OSC thread) Stamps the press with the current time and queues it
+       for the audio thread. This doesn't lock or allocate. Returns false
+       if the queue is full.
+
+       If a sampleOffset is given the clock is skipped, and the press goes
+       at that point of the next block (so offline renders come out the
+       same however fast they run).
+    */
+    bool addPress(const int &channel, const int &noteNumber, const bool &isNoteOn,
+                  const bool &isQuantised, const int &sampleOffset = -1);
+
+    /* (audio thread) Call this at the start of each block, before asking
+       for the presses with getNextPress().
+    */
+    void startBlock(const int &numSamples);
+
+    /* (audio thread) Gets the next press which is due in this block, and
+       where in the block it goes. Anything pressed too recently is kept
+       back for the next block. Returns false when there are no more.
+    */
+    bool getNextPress(Press &press, int &sampleOffset);
+
+    // the (constant) delay between a press and it being heard
+    int getLatencyInSamples() const { return latencyInSamples; }
+
+    // forgets any waiting presses and the clock
+    void reset();
+
+private:
+
+    // presses come in from the OSC thread through here
+    AbstractFifo incomingFifo;
+    Press incoming[maxNumPresses];
+
+    // the smoothed clock: when the current block started and
+    // when we expect the next one (in seconds)...
+    double blockStartTime, nextBlockTime;
+    // ...and how long each sample really lasts
+    double secondsPerSample;
+    int blockSize;          // (of the current block)
+    int latencyInSamples;   // the longest block since the last reset
+    bool clockRunning;      // (false until the first block)
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PressTimer);
+};
+
+
+#endif  // PRESSTIMER_H_INCLUDED
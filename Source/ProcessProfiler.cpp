@@ -0,0 +1,167 @@
+/*
+  ==============================================================================
+
+    ProcessProfiler.cpp
+    Created: 19 Oct 2026 5:31:09am
+    Author:  hemmer
+
+  ==============================================================================
+*/
+
+#include "ProcessProfiler.h"
+
+ProcessProfiler::ProcessProfiler() :
+    blockStartTicks(0), blockDeadline(0), load(0), peakLoad(0),
+    numOverruns(0), lastOverrunStage(-1), lastOverrunStrip(-1),
+    nanosecondsPerTick(1.0e9 / (double) Time::getHighResolutionTicksPerSecond())
+{
+    for (int s = 0; s < numStages; ++s)
+        blockTicks[s] = 0;
+}
+
+const char* ProcessProfiler::getStageName(const int &stage)
+{
+    switch (stage)
+    {
+    case stageEvents :      return "events";
+    case stagePatterns :    return "patterns";
+    case stageCapture :     return "capture";
+    case stageStrips :      return "strips";
+    case stageMixing :      return "mixing";
+    case stageTotal :       return "total";
+    default :               jassertfalse; return "";
+    }
+}
+
+void ProcessProfiler::Timing::set(const int &nanoseconds)
+{
+    last = nanoseconds;
+
+    // (only the audio thread sets a given timing, so this can't
+    // race with anything but resetPeaks, which just loses a peak)
+    if (nanoseconds > peak.get())
+        peak = nanoseconds;
+}
+
+int ProcessProfiler::ticksToNanoseconds(const int64 &ticks) const
+{
+    return (int) jmin((double) 0x7fffffff, ticks * nanosecondsPerTick);
+}
+
+void ProcessProfiler::startBlock(const int &numSamples, const double &sampleRate)
+{
+    for (int s = 0; s < numStages; ++s)
+        blockTicks[s] = 0;
+
+    blockStartTicks = now();
+    blockDeadline = (sampleRate > 0.0) ? (int) (numSamples * 1.0e9 / sampleRate) : 0;
+}
+
+void ProcessProfiler::endBlock(const int &numStrips)
+{
+    blockTicks[stageTotal] = now() - blockStartTicks;
+
+    for (int s = 0; s < numStages; ++s)
+        stages[s].set(ticksToNanoseconds(blockTicks[s]));
+
+    if (blockDeadline <= 0) return;
+
+    const int total = stages[stageTotal].last.get();
+    const int newLoad = (int) (1000.0 * total / blockDeadline);
+    load = newLoad;
+    if (newLoad > peakLoad.get())
+        peakLoad = newLoad;
+
+    if (total > blockDeadline)
+    {
+        // find the culprits
+        int slowestStage = 0, slowestStrip = -1;
+
+        for (int s = 1; s < stageTotal; ++s)
+            if (stages[s].last.get() > stages[slowestStage].last.get())
+                slowestStage = s;
+
+        for (int s = 0; s < jmin(numStrips, (int) maxNumStrips); ++s)
+            if (slowestStrip < 0 || strips[s].last.get() > strips[slowestStrip].last.get())
+                slowestStrip = s;
+
+        lastOverrunStage = slowestStage;
+        lastOverrunStrip = slowestStrip;
+        ++numOverruns;
+    }
+}
+
+void ProcessProfiler::stageDone(const int &stage, const int64 &startTicks)
+{
+    jassert(stage >= 0 && stage < stageTotal);
+    blockTicks[stage] += now() - startTicks;
+}
+
+void ProcessProfiler::stripDone(const int &stripID, const int64 &startTicks)
+{
+    if (stripID >= 0 && stripID < maxNumStrips)
+        strips[stripID].set(ticksToNanoseconds(now() - startTicks));
+}
+
+float ProcessProfiler::getStageTime(const int &stage) const
+{
+    return (stage >= 0 && stage < numStages) ? stages[stage].last.get() / 1000.0f : 0.0f;
+}
+
+float ProcessProfiler::getStagePeak(const int &stage) const
+{
+    return (stage >= 0 && stage < numStages) ? stages[stage].peak.get() / 1000.0f : 0.0f;
+}
+
+float ProcessProfiler::getStripTime(const int &stripID) const
+{
+    return (stripID >= 0 && stripID < maxNumStrips) ? strips[stripID].last.get() / 1000.0f : 0.0f;
+}
+
+float ProcessProfiler::getStripPeak(const int &stripID) const
+{
+    return (stripID >= 0 && stripID < maxNumStrips) ? strips[stripID].peak.get() / 1000.0f : 0.0f;
+}
+
+float ProcessProfiler::getLoad() const
+{
+    return load.get() / 1000.0f;
+}
+
+float ProcessProfiler::getPeakLoad() const
+{
+    return peakLoad.get() / 1000.0f;
+}
+
+void ProcessProfiler::resetPeaks()
+{
+    for (int s = 0; s < numStages; ++s)
+        stages[s].peak = 0;
+    for (int s = 0; s < maxNumStrips; ++s)
+        strips[s].peak = 0;
+
+    peakLoad = 0;
+}
+
+String ProcessProfiler::getSummary(const int &numStrips) const
+{
+    String summary;
+    summary << "dsp load " << roundToInt(100.0f * getLoad()) << "% (peak "
+            << roundToInt(100.0f * getPeakLoad()) << "%), overruns " << getNumOverruns();
+
+    if (getLastOverrunStage() >= 0)
+    {
+        summary << " (last: " << getStageName(getLastOverrunStage())
+                << ", strip " << getLastOverrunStrip() << ")";
+    }
+
+    // peaks in microseconds
+    summary << " | peak us:";
+    for (int s = 0; s < numStages; ++s)
+        summary << " " << getStageName(s) << " " << roundToInt(getStagePeak(s));
+
+    for (int s = 0; s < jmin(numStrips, (int) maxNumStrips); ++s)
+        summary << " s" << s << " " << roundToInt(getStripPeak(s));
+
+    return summary;
+}
@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+
+    ProcessProfiler.h
+    Created: 19 Oct 2026 5:31:09am
+    Author:  hemmer
+
+    Times each stage of processBlock (and each strip's render) so we can
+    see where the callback's time goes. The audio thread only reads the
+    high resolution clock and writes to atomics, so this is cheap enough
+    to leave running. As well as the last block's times we keep the peaks
+    (until resetPeaks) and count the blocks which took longer than their
+    deadline (the length of the block), noting which stage and strip was
+    slowest in the last one of those.
+
+  ==============================================================================
+*/
+
+#ifndef PROCESSPROFILER_H_INCLUDED
+#define PROCESSPROFILER_H_INCLUDED
+
+#include "JuceHeader.h"
+
+
+class ProcessProfiler
+{
+public:
+    ProcessProfiler();
+
+    enum Stage
+    {
+        stageEvents,        // presses, quantisation and MIDI
+        stagePatterns,      // pattern recording / playback
+        stageCapture,       // recording, resampling and the histories
+        stageStrips,        // rendering the strips (all of them)
+        stageMixing,        // master gain etc
+        stageTotal,         // the whole of processBlock
+        numStages
+    };
+    enum { maxNumStrips = 64 };
+
+    static const char* getStageName(const int &stage);
+
+    // the high resolution clock, pass this back in when the stage is done
+    static int64 now() { return Time::getHighResolutionTicks(); }
+
+    // (audio thread) call these around each block...
+    void startBlock(const int &numSamples, const double &sampleRate);
+    void endBlock(const int &numStrips);
+    // ...and these as each stage / strip finishes (a stage can be done in
+    // parts, and strips can be timed from any of the render threads)
+    void stageDone(const int &stage, const int64 &startTicks);
+    void stripDone(const int &stripID, const int64 &startTicks);
+
+    // All the times are in microseconds. These can be read from any thread.
+    float getStageTime(const int &stage) const;
+    float getStagePeak(const int &stage) const;
+    float getStripTime(const int &stripID) const;
+    float getStripPeak(const int &stripID) const;
+
+    // how much of the block's deadline was used (1.0 = all of it)
+    float getLoad() const;
+    float getPeakLoad() const;
+
+    int getNumOverruns() const { return numOverruns.get(); }
+    // which stage / strip was slowest in the last overrun (-1 if none)
+    int getLastOverrunStage() const { return lastOverrunStage.get(); }
+    int getLastOverrunStrip() const { return lastOverrunStrip.get(); }
+
+    void resetPeaks();
+
+    // one line of the above, for logging
+    String getSummary(const int &numStrips) const;
+
+private:
+
+    struct Timing
+    {
+        Timing() : last(0), peak(0) {}
+        void set(const int &nanoseconds);
+
+        Atomic<int> last, peak;     // (in nanoseconds)
+    };
+
+    Timing stages[numStages];
+    Timing strips[maxNumStrips];
+
+    // (audio thread) this block's times so far
+    int64 blockStartTicks;
+    int64 blockTicks[numStages];
+    int blockDeadline;              // (in nanoseconds)
+    Atomic<int> load, peakLoad;     // (in 1/1000ths of the deadline)
+
+    Atomic<int> numOverruns, lastOverrunStage, lastOverrunStrip;
+
+    const double nanosecondsPerTick;
+
+    int ticksToNanoseconds(const int64 &ticks) const;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ProcessProfiler);
+};
+
+
+#endif  // PROCESSPROFILER_H_INCLUDED
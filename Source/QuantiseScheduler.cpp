@@ -0,0 +1,119 @@
+/*
+  ==============================================================================
+
+    QuantiseScheduler.cpp
+    Created: 19 Oct 2026 2:07:51am
+    Author:  hemmer
+
+  ==============================================================================
+*/
+
+#include "QuantiseScheduler.h"
+
+QuantiseScheduler::QuantiseScheduler() :
+    incomingFifo(maxNumTriggers), numWaiting(0),
+    gridLengthInBeats(-1.0), clockPosition(0.0)
+{
+}
+
+void QuantiseScheduler::setGridLength(const double &newGridLengthInBeats)
+{
+    gridLengthInBeats = newGridLengthInBeats;
+}
+
+bool QuantiseScheduler::addTrigger(const int &channel, const int &noteNumber, const bool &isNoteOn,
+                                   const int &arrivalSample)
+{
+    int start1, size1, start2, size2;
+    incomingFifo.prepareToWrite(1, start1, size1, start2, size2);
+
+    if (size1 + size2 < 1)
+        return false;
+
+    Trigger &t = incoming[size1 > 0 ? start1 : start2];
+    t.channel = channel;
+    t.noteNumber = noteNumber;
+    t.isNoteOn = isNoteOn;
+    t.arrivalSample = arrivalSample;
+
+    incomingFifo.finishedWrite(1);
+    return true;
+}
+
+void QuantiseScheduler::processBlock(MidiBuffer &midiMessages, const int &numSamples,
+                                     const double &samplesPerBeat, const double *hostPositionInBeats)
+{
+    // Take whatever has been pressed since the last block, as long as
+    // there's room to wait (anything else stays queued for next time).
+    int start1, size1, start2, size2;
+    incomingFifo.prepareToRead(jmin(incomingFifo.getNumReady(), maxNumTriggers - numWaiting),
+                               start1, size1, start2, size2);
+
+    for (int i = 0; i < size1; ++i)
+        waiting[numWaiting++] = incoming[start1 + i];
+    for (int i = 0; i < size2; ++i)
+        waiting[numWaiting++] = incoming[start2 + i];
+
+    incomingFifo.finishedRead(size1 + size2);
+
+
+    // keep our clock going, following the host when it's playing
+    const double blockStart = (hostPositionInBeats != nullptr) ? *hostPositionInBeats : clockPosition;
+    const double blockLength = (samplesPerBeat > 0.0) ? numSamples / samplesPerBeat : 0.0;
+    clockPosition = blockStart + blockLength;
+
+    if (numWaiting == 0) return;
+
+    int numDone = 0;
+
+    if (!isQuantising() || samplesPerBeat <= 0.0)
+    {
+        // nothing to wait for
+        for (; numDone < numWaiting; ++numDone)
+        {
+            const Trigger &t = waiting[numDone];
+            midiMessages.addEvent(t.isNoteOn ? MidiMessage::noteOn(t.channel, t.noteNumber, 1.0f)
+                                             : MidiMessage::noteOff(t.channel, t.noteNumber),
+                                  jlimit(0, numSamples - 1, t.arrivalSample));
+        }
+    }
+    else
+    {
+        // the first grid line at or after the start of the block (allowing
+        // for rounding when the block starts right on a line)
+        double gridLine = ceil(blockStart / gridLengthInBeats - 1.0e-9) * gridLengthInBeats;
+
+        // go through every line in the block, firing anything
+        // that had been pressed by then (in the order pressed)
+        while (numDone < numWaiting && gridLine < blockStart + blockLength)
+        {
+            const int offset = jlimit(0, numSamples - 1, roundToInt((gridLine - blockStart) * samplesPerBeat));
+
+            while (numDone < numWaiting && waiting[numDone].arrivalSample <= offset)
+            {
+                const Trigger &t = waiting[numDone++];
+                midiMessages.addEvent(t.isNoteOn ? MidiMessage::noteOn(t.channel, t.noteNumber, 1.0f)
+                                                 : MidiMessage::noteOff(t.channel, t.noteNumber),
+                                      offset);
+            }
+
+            gridLine += gridLengthInBeats;
+        }
+    }
+
+    // shuffle down what's left, which was all pressed
+    // before the next block starts
+    for (int i = numDone; i < numWaiting; ++i)
+    {
+        waiting[i - numDone] = waiting[i];
+        waiting[i - numDone].arrivalSample = 0;
+    }
+    numWaiting -= numDone;
+}
+
+void QuantiseScheduler::reset()
+{
+    incomingFifo.reset();
+    numWaiting = 0;
+    clockPosition = 0.0;
+}
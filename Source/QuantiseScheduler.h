@@ -0,0 +1,78 @@
+/*
+  ==============================================================================
+
+    QuantiseScheduler.h
+    Created: 19 Oct 2026 2:07:51am
+    Author:  hemmer
+
+    Holds back quantised monome presses until the next line of the
+    quantisation grid. The grid lines are worked out for each block from
+    the host's position (in beats) when it is playing, or from our own
+    clock when it isn't, so the notes land exactly on the host's grid and
+    a block can contain several grid lines.
+
+  ==============================================================================
+*/
+
+#ifndef QUANTISESCHEDULER_H_INCLUDED
+#define QUANTISESCHEDULER_H_INCLUDED
+
+#include "JuceHeader.h"
+
+
+class QuantiseScheduler
+{
+public:
+    QuantiseScheduler();
+
+    enum { maxNumTriggers = 256 };  // presses that can be waiting at once
+
+    /* Sets the spacing of the grid in beats (zero or less turns it off,
+       so anything waiting goes at the start of the next block).
+    */
+    void setGridLength(const double &newGridLengthInBeats);
+    bool isQuantising() const { return gridLengthInBeats > 0.0; }
+
+    /* Queues a note until the next grid line. This doesn't lock or
+       allocate, so any thread can call it. arrivalSample is where in
+       the next block the press happened (if it's known), as it can't
+       go on a line before then. Returns false if the queue is full.
+    */
+    bool addTrigger(const int &channel, const int &noteNumber, const bool &isNoteOn,
+                    const int &arrivalSample = 0);
+
+    /* (audio thread) Adds any notes which are due on this block's grid
+       lines to midiMessages. hostPositionInBeats is the host's position
+       at the start of the block, or null to use our own clock.
+    */
+    void processBlock(MidiBuffer &midiMessages, const int &numSamples,
+                      const double &samplesPerBeat, const double *hostPositionInBeats);
+
+    // forgets any waiting notes (and restarts our clock)
+    void reset();
+
+private:
+
+    struct Trigger
+    {
+        int channel, noteNumber;
+        bool isNoteOn;
+        int arrivalSample;
+    };
+
+    // presses come in from other threads through here...
+    AbstractFifo incomingFifo;
+    Trigger incoming[maxNumTriggers];
+    // ...and wait here (on the audio thread) for a grid line
+    Trigger waiting[maxNumTriggers];
+    int numWaiting;
+
+    double gridLengthInBeats;
+    // where we think we are (in beats) when the host isn't playing
+    double clockPosition;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(QuantiseScheduler);
+};
+
+
+#endif  // QUANTISESCHEDULER_H_INCLUDED
@@ -0,0 +1,557 @@
+/*
+  ==============================================================================
+
+    RenderKernels.cpp
+    Created: 18 Oct 2026 10:12:40am
+    Author:  hemmer
+
+  ==============================================================================
+*/
+
+#include "RenderKernels.h"
+
+#if JUCE_INTEL
+ #include <emmintrin.h>
+ #define MLR_USE_SSE_KERNELS 1
+#endif
+
+#if MLR_USE_SSE_KERNELS
+namespace
+{
+    // same approach as JUCE's FloatVectorOperations: check once for SSE2
+    // and fall back to the scalar loop on (very) old 32-bit machines
+    bool sse2Checked = false, sse2Present = false;
+
+    bool isSSE2Available()
+    {
+        if (! sse2Checked)
+        {
+            sse2Present = SystemStats::hasSSE2();
+            sse2Checked = true;
+        }
+
+        return sse2Present;
+    }
+
+    // applies the gain to four samples and adds them to the output
+    inline void addFour(float* outL, float* outR, __m128 l, __m128 r, const __m128 &g)
+    {
+        l = _mm_mul_ps(l, g);
+        r = _mm_mul_ps(r, g);
+
+        if (outR != nullptr)
+        {
+            _mm_storeu_ps(outL, _mm_add_ps(_mm_loadu_ps(outL), l));
+            _mm_storeu_ps(outR, _mm_add_ps(_mm_loadu_ps(outR), r));
+        }
+        else
+        {
+            // average the two channels
+            const __m128 mono = _mm_mul_ps(_mm_add_ps(l, r), _mm_set1_ps(0.5f));
+            _mm_storeu_ps(outL, _mm_add_ps(_mm_loadu_ps(outL), mono));
+        }
+    }
+
+    // 4 point, 3rd order Hermite (x is the frac position between x0 and x1)
+    inline __m128 hermite(const __m128 &xm1, const __m128 &x0, const __m128 &x1,
+                          const __m128 &x2, const __m128 &x)
+    {
+        const __m128 half = _mm_set1_ps(0.5f);
+        const __m128 c1 = _mm_mul_ps(half, _mm_sub_ps(x1, xm1));
+        const __m128 c2 = _mm_sub_ps(_mm_add_ps(_mm_sub_ps(xm1, _mm_mul_ps(_mm_set1_ps(2.5f), x0)),
+                                                _mm_add_ps(x1, x1)),
+                                     _mm_mul_ps(half, x2));
+        const __m128 c3 = _mm_add_ps(_mm_mul_ps(half, _mm_sub_ps(x2, xm1)),
+                                     _mm_mul_ps(_mm_set1_ps(1.5f), _mm_sub_ps(x0, x1)));
+
+        return _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(c3, x), c2), x), c1), x), x0);
+    }
+}
+#endif
+
+namespace
+{
+    // the envelope gain for output sample i (see addRun)
+    inline float envelopeGain(const float gain, const float envStart, const float envIncrement, const int i)
+    {
+        return gain * jlimit(0.0f, 1.0f, envStart + (i + 1) * envIncrement);
+    }
+
+    // adds a single (already gained) sample to the output
+    inline void addOne(float* outL, float* outR, const int i, const float l, const float r)
+    {
+        if (outR != nullptr)
+        {
+            outL[i] += l;
+            outR[i] += r;
+        }
+        else
+        {
+            outL[i] += (l + r) * 0.5f;
+        }
+    }
+
+    // 4 point, 3rd order Hermite (x is the frac position between x0 and x1)
+    inline float hermite(const float xm1, const float x0, const float x1, const float x2, const float x)
+    {
+        const float c1 = 0.5f * (x1 - xm1);
+        const float c2 = xm1 - 2.5f * x0 + 2.0f * x1 - 0.5f * x2;
+        const float c3 = 0.5f * (x2 - xm1) + 1.5f * (x0 - x1);
+
+        return ((c3 * x + c2) * x + c1) * x + x0;
+    }
+
+
+    /* Polyphase windowed-sinc coefficients. Each table is designed for a
+       maximum playspeed: the cutoff is lowered by the same factor (so
+       pitching up doesn't alias) and the kernel gets longer to keep the
+       same steepness. Each table has numPhases + 1 rows of coefficients,
+       the rows either side of the read position are interpolated.
+    */
+    class SincTables
+    {
+    public:
+        enum { numTables = 5, numPhases = 256, baseNumTaps = 16 };
+
+        SincTables()
+        {
+            const double speeds[numTables] = { 1.0, 1.5, 2.0, 3.0, 4.0 };
+
+            for (int t = 0; t < numTables; ++t)
+            {
+                maxIncrement[t] = speeds[t];
+                numTaps[t] = baseNumTaps * (int) ceil(speeds[t]);
+                // just under nyquist to leave room for the transition band
+                buildTable(t, 0.45 / speeds[t]);
+            }
+        }
+
+        // the first table which can handle this speed (or the last)
+        int getTableIndex(const double &absIncrement) const
+        {
+            for (int t = 0; t < numTables - 1; ++t)
+                if (absIncrement <= maxIncrement[t]) return t;
+
+            return numTables - 1;
+        }
+
+        int getNumTaps(const int &table) const { return numTaps[table]; }
+
+        // coefficients for the given phase (0 to numPhases inclusive)
+        const float* getPhase(const int &table, const int &phase) const
+        {
+            return coefficients[table] + phase * numTaps[table];
+        }
+
+    private:
+        void buildTable(const int &table, const double &cutoff)
+        {
+            const int taps = numTaps[table];
+            const int halfTaps = taps / 2;
+            const double beta = 7.0;    // Kaiser window, about 70dB down
+            const double windowScale = 1.0 / besselI0(beta);
+
+            coefficients[table].malloc((numPhases + 1) * taps);
+
+            for (int p = 0; p <= numPhases; ++p)
+            {
+                const double frac = p / (double) numPhases;
+                float* const row = coefficients[table] + p * taps;
+                double sum = 0.0;
+
+                for (int k = 0; k < taps; ++k)
+                {
+                    // distance from the read position to this tap
+                    const double x = (k - halfTaps + 1) - frac;
+                    const double w = x / halfTaps;
+                    const double window = besselI0(beta * sqrt(jmax(0.0, 1.0 - w * w))) * windowScale;
+
+                    const double arg = double_Pi * 2.0 * cutoff * x;
+                    const double sinc = (arg == 0.0) ? 1.0 : sin(arg) / arg;
+
+                    const double h = 2.0 * cutoff * sinc * window;
+                    row[k] = (float) h;
+                    sum += h;
+                }
+
+                // normalise each phase so the DC gain is exactly 1
+                for (int k = 0; k < taps; ++k)
+                    row[k] = (float) (row[k] / sum);
+            }
+        }
+
+        // zeroth order modified Bessel function (for the Kaiser window)
+        static double besselI0(const double &x)
+        {
+            double sum = 1.0, term = 1.0;
+            const double halfX = 0.5 * x;
+
+            for (int k = 1; k < 32; ++k)
+            {
+                term *= (halfX / k) * (halfX / k);
+                sum += term;
+                if (term < sum * 1.0e-12) break;
+            }
+
+            return sum;
+        }
+
+        HeapBlock<float> coefficients[numTables];
+        double maxIncrement[numTables];
+        int numTaps[numTables];
+    };
+
+    // built once when the plugin is loaded
+    const SincTables sincTables;
+
+
+    // Filters numTaps input samples (from in) with the coefficients between
+    // phases c0 and c1. The taps are always a multiple of 16 (see above).
+    inline void sincDotProduct(const float* inL, const float* inR,
+                               const float* c0, const float* c1, const float phaseFrac,
+                               const int numTaps, float &outL, float &outR)
+    {
+#if MLR_USE_SSE_KERNELS
+        if (isSSE2Available())
+        {
+            const __m128 fracV = _mm_set1_ps(phaseFrac);
+            __m128 accL = _mm_setzero_ps(), accR = _mm_setzero_ps();
+
+            for (int k = 0; k < numTaps; k += 4)
+            {
+                const __m128 a = _mm_loadu_ps(c0 + k);
+                const __m128 coeff = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(c1 + k), a), fracV));
+
+                accL = _mm_add_ps(accL, _mm_mul_ps(coeff, _mm_loadu_ps(inL + k)));
+                if (inR != nullptr)
+                    accR = _mm_add_ps(accR, _mm_mul_ps(coeff, _mm_loadu_ps(inR + k)));
+            }
+
+            // horizontal sums
+            accL = _mm_add_ps(accL, _mm_movehl_ps(accL, accL));
+            accL = _mm_add_ss(accL, _mm_shuffle_ps(accL, accL, 1));
+            outL = _mm_cvtss_f32(accL);
+
+            if (inR != nullptr)
+            {
+                accR = _mm_add_ps(accR, _mm_movehl_ps(accR, accR));
+                accR = _mm_add_ss(accR, _mm_shuffle_ps(accR, accR, 1));
+                outR = _mm_cvtss_f32(accR);
+            }
+            else
+            {
+                outR = outL;
+            }
+
+            return;
+        }
+#endif
+
+        float l = 0.0f, r = 0.0f;
+        for (int k = 0; k < numTaps; ++k)
+        {
+            const float coeff = c0[k] + (c1[k] - c0[k]) * phaseFrac;
+            l += coeff * inL[k];
+            if (inR != nullptr) r += coeff * inR[k];
+        }
+
+        outL = l;
+        outR = (inR != nullptr) ? r : l;
+    }
+
+    // as above, but clamping each read (for either end of the sample)
+    inline void sincDotProductClamped(const float* inL, const float* inR, const int lastSample,
+                                      const int first, const float* c0, const float* c1,
+                                      const float phaseFrac, const int numTaps,
+                                      float &outL, float &outR)
+    {
+        float l = 0.0f, r = 0.0f;
+        for (int k = 0; k < numTaps; ++k)
+        {
+            const int index = jlimit(0, lastSample, first + k);
+            const float coeff = c0[k] + (c1[k] - c0[k]) * phaseFrac;
+            l += coeff * inL[index];
+            if (inR != nullptr) r += coeff * inR[index];
+        }
+
+        outL = l;
+        outR = (inR != nullptr) ? r : l;
+    }
+}
+
+
+void RenderKernels::addRun(const int &interpolation,
+                           const float* inL, const float* inR, const int inLength,
+                           float* outL, float* outR, const int numSamples,
+                           const double startPosition, const double increment,
+                           const float gain, const float envStart, const float envIncrement)
+{
+    switch (interpolation)
+    {
+    case iCubic :
+        addCubicRun(inL, inR, inLength, outL, outR, numSamples,
+                    startPosition, increment, gain, envStart, envIncrement);
+        break;
+
+    case iSinc :
+        addSincRun(inL, inR, inLength, outL, outR, numSamples,
+                   startPosition, increment, gain, envStart, envIncrement);
+        break;
+
+    default :
+        jassert(interpolation == iLinear);
+        addLinearRun(inL, inR, inLength, outL, outR, numSamples,
+                     startPosition, increment, gain, envStart, envIncrement);
+    }
+}
+
+void RenderKernels::addLinearRun(const float* inL, const float* inR, const int inLength,
+                                 float* outL, float* outR, const int numSamples,
+                                 const double startPosition, const double increment,
+                                 const float gain, const float envStart, const float envIncrement)
+{
+    jassert(inL != nullptr && outL != nullptr && inLength > 0);
+
+#if MLR_USE_SSE_KERNELS
+    if (numSamples >= 4 && isSSE2Available())
+    {
+        const int lastSample = inLength - 1;
+        const double maxPosition = (double) lastSample;
+
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 gainV = _mm_set1_ps(gain);
+        const __m128 envStep = _mm_set1_ps(4.0f * envIncrement);
+        // envelope for the first four samples (i + 1 = 1, 2, 3, 4)
+        __m128 env = _mm_add_ps(_mm_set1_ps(envStart),
+                                _mm_mul_ps(_mm_set1_ps(envIncrement), _mm_set_ps(4.0f, 3.0f, 2.0f, 1.0f)));
+
+        // gather buffers for the four read positions
+        JUCE_ALIGN(16) float l0[4], l1[4], r0[4], r1[4], frac[4];
+
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4)
+        {
+            // the reads are scattered so gather them into
+            // vectors, the interpolation is then vectorised
+            for (int k = 0; k < 4; ++k)
+            {
+                const double pos = jlimit(0.0, maxPosition, startPosition + (i + k) * increment);
+                const int index = (int) pos;
+                const int nextIndex = jmin(index + 1, lastSample);
+
+                frac[k] = (float) (pos - index);
+                l0[k] = inL[index];
+                l1[k] = inL[nextIndex];
+
+                if (inR != nullptr)
+                {
+                    r0[k] = inR[index];
+                    r1[k] = inR[nextIndex];
+                }
+            }
+
+            const __m128 fracV = _mm_load_ps(frac);
+            const __m128 l0V = _mm_load_ps(l0);
+            const __m128 l = _mm_add_ps(l0V, _mm_mul_ps(_mm_sub_ps(_mm_load_ps(l1), l0V), fracV));
+            __m128 r = l;
+
+            if (inR != nullptr)
+            {
+                const __m128 r0V = _mm_load_ps(r0);
+                r = _mm_add_ps(r0V, _mm_mul_ps(_mm_sub_ps(_mm_load_ps(r1), r0V), fracV));
+            }
+
+            // apply the strip gain and (clamped) envelope
+            const __m128 g = _mm_mul_ps(gainV, _mm_min_ps(one, _mm_max_ps(zero, env)));
+            env = _mm_add_ps(env, envStep);
+
+            addFour(outL + i, (outR != nullptr) ? outR + i : nullptr, l, r, g);
+        }
+
+        // finish off any remaining samples
+        if (i < numSamples)
+            addLinearRunScalar(inL, inR, inLength,
+                               outL + i, (outR != nullptr) ? outR + i : nullptr, numSamples - i,
+                               startPosition + i * increment, increment,
+                               gain, envStart + i * envIncrement, envIncrement);
+        return;
+    }
+#endif
+
+    addLinearRunScalar(inL, inR, inLength, outL, outR, numSamples,
+                       startPosition, increment, gain, envStart, envIncrement);
+}
+
+void RenderKernels::addLinearRunScalar(const float* inL, const float* inR, const int inLength,
+                                       float* outL, float* outR, const int numSamples,
+                                       const double startPosition, const double increment,
+                                       const float gain, const float envStart, const float envIncrement)
+{
+    const int lastSample = inLength - 1;
+    const double maxPosition = (double) lastSample;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const double pos = jlimit(0.0, maxPosition, startPosition + i * increment);
+        const int index = (int) pos;
+        const int nextIndex = jmin(index + 1, lastSample);
+        const float alpha = (float) (pos - index);
+
+        const float g = envelopeGain(gain, envStart, envIncrement, i);
+
+        // double up if mono
+        const float l = (inL[index] + (inL[nextIndex] - inL[index]) * alpha) * g;
+        const float r = (inR != nullptr) ? (inR[index] + (inR[nextIndex] - inR[index]) * alpha) * g : l;
+
+        addOne(outL, outR, i, l, r);
+    }
+}
+
+
+void RenderKernels::addCubicRun(const float* inL, const float* inR, const int inLength,
+                                float* outL, float* outR, const int numSamples,
+                                const double startPosition, const double increment,
+                                const float gain, const float envStart, const float envIncrement)
+{
+    jassert(inL != nullptr && outL != nullptr && inLength > 0);
+
+#if MLR_USE_SSE_KERNELS
+    if (numSamples >= 4 && isSSE2Available())
+    {
+        const int lastSample = inLength - 1;
+        const double maxPosition = (double) lastSample;
+
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 gainV = _mm_set1_ps(gain);
+        const __m128 envStep = _mm_set1_ps(4.0f * envIncrement);
+        __m128 env = _mm_add_ps(_mm_set1_ps(envStart),
+                                _mm_mul_ps(_mm_set1_ps(envIncrement), _mm_set_ps(4.0f, 3.0f, 2.0f, 1.0f)));
+
+        // gather buffers for the four points around each of the four read positions
+        JUCE_ALIGN(16) float lm1[4], l0[4], l1[4], l2[4];
+        JUCE_ALIGN(16) float rm1[4], r0[4], r1[4], r2[4];
+        JUCE_ALIGN(16) float frac[4];
+
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4)
+        {
+            for (int k = 0; k < 4; ++k)
+            {
+                const double pos = jlimit(0.0, maxPosition, startPosition + (i + k) * increment);
+                const int index = (int) pos;
+                const int prevIndex = jmax(index - 1, 0);
+                const int nextIndex = jmin(index + 1, lastSample);
+                const int nextNextIndex = jmin(index + 2, lastSample);
+
+                frac[k] = (float) (pos - index);
+                lm1[k] = inL[prevIndex];
+                l0[k] = inL[index];
+                l1[k] = inL[nextIndex];
+                l2[k] = inL[nextNextIndex];
+
+                if (inR != nullptr)
+                {
+                    rm1[k] = inR[prevIndex];
+                    r0[k] = inR[index];
+                    r1[k] = inR[nextIndex];
+                    r2[k] = inR[nextNextIndex];
+                }
+            }
+
+            const __m128 fracV = _mm_load_ps(frac);
+            const __m128 l = hermite(_mm_load_ps(lm1), _mm_load_ps(l0), _mm_load_ps(l1), _mm_load_ps(l2), fracV);
+            const __m128 r = (inR != nullptr)
+                ? hermite(_mm_load_ps(rm1), _mm_load_ps(r0), _mm_load_ps(r1), _mm_load_ps(r2), fracV)
+                : l;
+
+            const __m128 g = _mm_mul_ps(gainV, _mm_min_ps(one, _mm_max_ps(zero, env)));
+            env = _mm_add_ps(env, envStep);
+
+            addFour(outL + i, (outR != nullptr) ? outR + i : nullptr, l, r, g);
+        }
+
+        if (i < numSamples)
+            addCubicRunScalar(inL, inR, inLength,
+                              outL + i, (outR != nullptr) ? outR + i : nullptr, numSamples - i,
+                              startPosition + i * increment, increment,
+                              gain, envStart + i * envIncrement, envIncrement);
+        return;
+    }
+#endif
+
+    addCubicRunScalar(inL, inR, inLength, outL, outR, numSamples,
+                      startPosition, increment, gain, envStart, envIncrement);
+}
+
+void RenderKernels::addCubicRunScalar(const float* inL, const float* inR, const int inLength,
+                                      float* outL, float* outR, const int numSamples,
+                                      const double startPosition, const double increment,
+                                      const float gain, const float envStart, const float envIncrement)
+{
+    const int lastSample = inLength - 1;
+    const double maxPosition = (double) lastSample;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const double pos = jlimit(0.0, maxPosition, startPosition + i * increment);
+        const int index = (int) pos;
+        const int prevIndex = jmax(index - 1, 0);
+        const int nextIndex = jmin(index + 1, lastSample);
+        const int nextNextIndex = jmin(index + 2, lastSample);
+        const float alpha = (float) (pos - index);
+
+        const float g = envelopeGain(gain, envStart, envIncrement, i);
+
+        const float l = hermite(inL[prevIndex], inL[index], inL[nextIndex], inL[nextNextIndex], alpha) * g;
+        const float r = (inR != nullptr)
+            ? hermite(inR[prevIndex], inR[index], inR[nextIndex], inR[nextNextIndex], alpha) * g
+            : l;
+
+        addOne(outL, outR, i, l, r);
+    }
+}
+
+
+void RenderKernels::addSincRun(const float* inL, const float* inR, const int inLength,
+                               float* outL, float* outR, const int numSamples,
+                               const double startPosition, const double increment,
+                               const float gain, const float envStart, const float envIncrement)
+{
+    jassert(inL != nullptr && outL != nullptr && inLength > 0);
+
+    const int table = sincTables.getTableIndex(fabs(increment));
+    const int numTaps = sincTables.getNumTaps(table);
+    const int halfTaps = numTaps / 2;
+
+    const int lastSample = inLength - 1;
+    const double maxPosition = (double) lastSample;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const double pos = jlimit(0.0, maxPosition, startPosition + i * increment);
+        const int index = (int) pos;
+
+        // find the two phases either side of the read position
+        const float phasePosition = (float) (pos - index) * SincTables::numPhases;
+        const int phase = jmin((int) phasePosition, SincTables::numPhases - 1);
+        const float phaseFrac = phasePosition - phase;
+        const float* const c0 = sincTables.getPhase(table, phase);
+        const float* const c1 = sincTables.getPhase(table, phase + 1);
+
+        // the first input sample under the kernel
+        const int first = index - halfTaps + 1;
+
+        float l, r;
+        if (first >= 0 && first + numTaps <= inLength)
+            sincDotProduct(inL + first, (inR != nullptr) ? inR + first : nullptr,
+                           c0, c1, phaseFrac, numTaps, l, r);
+        else
+            sincDotProductClamped(inL, inR, lastSample, first,
+                                  c0, c1, phaseFrac, numTaps, l, r);
+
+        const float g = envelopeGain(gain, envStart, envIncrement, i);
+        addOne(outL, outR, i, l * g, r * g);
+    }
+}
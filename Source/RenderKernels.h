@@ -0,0 +1,106 @@
+/*
+  ==============================================================================
+
+    RenderKernels.h
+    Created: 18 Oct 2026 10:12:40am
+    Author:  hemmer
+
+    Inner loops for SampleStrip playback. SampleStrip splits each section
+    into runs where nothing changes state (no loop points, no ramps
+    starting or finishing) and hands each run to one of these kernels,
+    so the per-sample work is just interpolation and gain.
+
+  ==============================================================================
+*/
+
+#ifndef RENDERKERNELS_H_INCLUDED
+#define RENDERKERNELS_H_INCLUDED
+
+#include "JuceHeader.h"
+
+
+class RenderKernels
+{
+public:
+
+    // How the sample is read between sample points. These are in order of
+    // cost: linear is cheapest but aliases when the playspeed is far from
+    // 1.0, the sinc kernel is band-limited for speeds up to 4x.
+    enum InterpolationMode
+    {
+        iLinear,        // 2 point linear
+        iCubic,         // 4 point cubic Hermite
+        iSinc,          // windowed-sinc (16 to 64 points)
+        NumInterpolationModes
+    };
+
+    static String getInterpolationName(const int &mode)
+    {
+        switch (mode)
+        {
+        case iLinear : return "linear";
+        case iCubic : return "cubic";
+        case iSinc : return "sinc (best)";
+        default : jassertfalse; return "error!";
+        }
+    }
+
+    /* Interpolates numSamples from the input channels, starting at
+       startPosition and moving by increment each output sample, and ADDS
+       the result to the output channels.
+
+       The gain for output sample i is:
+
+           gain * jlimit(0, 1, envStart + (i + 1) * envIncrement)
+
+       so a steady run uses envStart = 1, envIncrement = 0, and ramps up /
+       down just use a positive / negative increment.
+
+       If inR is null the left channel is doubled up; if outR is null the
+       two channels are averaged into outL. Any read positions outside the
+       input are clamped to the first / last sample.
+    */
+    static void addRun(const int &interpolation,
+                       const float* inL, const float* inR, const int inLength,
+                       float* outL, float* outR, const int numSamples,
+                       const double startPosition, const double increment,
+                       const float gain, const float envStart, const float envIncrement);
+
+    // the individual kernels used by addRun (same arguments)
+    static void addLinearRun(const float* inL, const float* inR, const int inLength,
+                             float* outL, float* outR, const int numSamples,
+                             const double startPosition, const double increment,
+                             const float gain, const float envStart, const float envIncrement);
+
+    static void addCubicRun(const float* inL, const float* inR, const int inLength,
+                            float* outL, float* outR, const int numSamples,
+                            const double startPosition, const double increment,
+                            const float gain, const float envStart, const float envIncrement);
+
+    /* The sinc tables are built for a few playspeeds (1x, 1.5x, 2x, 3x and
+       4x) with the cutoff lowered to match, so pitching up doesn't alias.
+       The table is chosen from the increment so is fixed for the run.
+    */
+    static void addSincRun(const float* inL, const float* inR, const int inLength,
+                           float* outL, float* outR, const int numSamples,
+                           const double startPosition, const double increment,
+                           const float gain, const float envStart, const float envIncrement);
+
+private:
+
+    static void addLinearRunScalar(const float* inL, const float* inR, const int inLength,
+                                   float* outL, float* outR, const int numSamples,
+                                   const double startPosition, const double increment,
+                                   const float gain, const float envStart, const float envIncrement);
+
+    static void addCubicRunScalar(const float* inL, const float* inR, const int inLength,
+                                  float* outL, float* outR, const int numSamples,
+                                  const double startPosition, const double increment,
+                                  const float gain, const float envStart, const float envIncrement);
+
+    RenderKernels();
+    JUCE_DECLARE_NON_COPYABLE(RenderKernels);
+};
+
+
+#endif  // RENDERKERNELS_H_INCLUDED
@@ -0,0 +1,178 @@
+/*
+  ==============================================================================
+
+    SampleCapture.cpp
+    Created: 18 Oct 2026 11:48:05pm
+    Author:  hemmer
+
+  ==============================================================================
+*/
+
+#include "SampleCapture.h"
+#include "AudioSample.h"
+#include "CaptureHistory.h"
+#include "ThumbnailBuilder.h"
+
+SampleCapture::SampleCapture(TimeSliceThread &thread, const ThumbnailBuilder &builder) :
+    captureThread(thread), thumbnailBuilder(builder),
+    state(sIdle), spare(new AudioSampleBuffer(2, 0)), target(nullptr), history(nullptr),
+    lengthInSamples(0), precountLengthInSamples(0),
+    position(0), precountPosition(0)
+{
+    captureThread.addTimeSliceClient(this);
+}
+
+SampleCapture::~SampleCapture()
+{
+    // (this waits if the thread is using us)
+    captureThread.removeTimeSliceClient(this);
+}
+
+void SampleCapture::reserve(const int &maxLengthInSamples)
+{
+    if (! state.compareAndSetBool(sStarting, sIdle))
+        return;
+
+    // Only grow the buffer, we want to keep as much room as
+    // possible so that later (longer) takes don't allocate.
+    if (spare->getNumChannels() != 2 || spare->getNumSamples() < maxLengthInSamples)
+        spare->setSize(2, maxLengthInSamples, false, false, true);
+
+    state = sIdle;
+}
+
+bool SampleCapture::start(AudioSample *targetSample, const int &takeLengthInSamples,
+                          const int &precountLength)
+{
+    jassert(targetSample != nullptr && takeLengthInSamples > 0);
+
+    if (! state.compareAndSetBool(sStarting, sIdle))
+        return false;
+
+    target = targetSample;
+    history = nullptr;
+    lengthInSamples = takeLengthInSamples;
+    precountLengthInSamples = precountLength;
+    precountPosition = precountLength;
+    position = 0;
+
+    // the capture thread does the rest (see useTimeSlice)
+    state = sPending;
+    captureThread.moveToFrontOfQueue(this);
+    return true;
+}
+
+bool SampleCapture::startFromHistory(AudioSample *targetSample, const CaptureHistory &historyToKeep,
+                                     const int &takeLengthInSamples)
+{
+    jassert(targetSample != nullptr);
+
+    if (! state.compareAndSetBool(sStarting, sIdle))
+        return false;
+
+    target = targetSample;
+    history = &historyToKeep;
+    lengthInSamples = takeLengthInSamples;
+    precountLengthInSamples = precountPosition = 0;
+    position = 0;
+
+    // the capture thread does the copy (see useTimeSlice)
+    state = sPending;
+    captureThread.moveToFrontOfQueue(this);
+    return true;
+}
+
+bool SampleCapture::process(const AudioSampleBuffer &input, const int &numSamples, const double &sampleRate)
+{
+    const int currentState = state.get();
+
+    // if we are still during the precount, do nothing
+    if (currentState == sPrecount)
+    {
+        // TODO: this sample count could be more accurate!
+        precountPosition -= numSamples;
+
+        if (precountPosition <= 0)
+            state = sCapturing;
+
+        return false;
+    }
+
+    if (currentState == sCapturing)
+    {
+        // add the current input into the take (stopping at the end)
+        const int samplesToAdd = jmin(numSamples, lengthInSamples - position);
+        spare->addFrom(0, position, input, 0, 0, samplesToAdd);
+        spare->addFrom(1, position, input, 1, 0, samplesToAdd);
+        position += samplesToAdd;
+
+        if (position < lengthInSamples)
+            return false;
+    }
+    else if (currentState != sFinished)
+        return false;
+
+    // Finished, so hand the take to the sample. This just swaps the
+    // pointers: the sample's old buffer is now our spare and will be
+    // reused (or freed) by the next start() / reserve().
+    target->swapAudioData(spare, sampleRate);
+
+    state = sIdle;
+    return true;
+}
+
+int SampleCapture::useTimeSlice()
+{
+    if (state.get() != sPending)
+        return 500;
+
+    // the spare buffer may have just been swapped out of a
+    // slot, so let any thumbnail of it finish first
+    if (! thumbnailBuilder.isIdle())
+        return 5;
+
+    if (! state.compareAndSetBool(sStarting, sPending))
+        return 500;
+
+    // If the spare buffer is already big enough this just changes its
+    // size (no allocation), otherwise we allocate here rather than on
+    // the audio thread.
+    spare->setSize(2, jmax(1, lengthInSamples), false, false, true);
+
+    if (history != nullptr)
+    {
+        // keeping the last take, so the audio thread only has to swap it in
+        if (! history->readLatest(*spare, lengthInSamples))
+        {
+            DBG("not enough history to keep the last take");
+            state = sIdle;
+            return 500;
+        }
+
+        position = lengthInSamples;
+        state = sFinished;
+        return 500;
+    }
+
+    spare->clear();
+
+    // the audio thread can have it now
+    state = (precountPosition > 0) ? sPrecount : sCapturing;
+    return 500;
+}
+
+float SampleCapture::getPrecountPercent() const
+{
+    if (precountPosition <= 0 || precountLengthInSamples <= 0)
+        return 0.0;
+    else
+        return (float) (precountPosition) / (float) (precountLengthInSamples);
+}
+
+float SampleCapture::getPercent() const
+{
+    if (position >= lengthInSamples || lengthInSamples <= 0)
+        return 0.0;
+    else
+        return (float) (position) / (float) (lengthInSamples);
+}
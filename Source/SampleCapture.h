@@ -0,0 +1,114 @@
+/*
+  ==============================================================================
+
+    SampleCapture.h
+    Created: 18 Oct 2026 11:48:05pm
+    Author:  hemmer
+
+    Records a take (from the inputs or the plugin's own output) into one
+    of the record / resample slots without the audio thread ever having
+    to allocate, lock or copy the take. The audio is written straight into
+    a spare buffer and, once the take is complete, that buffer is swapped
+    into the slot's AudioSample. The slot's old buffer then becomes the
+    spare for the next take, and it's only ever resized or freed on the
+    capture thread or in reserve(), never by the audio thread.
+
+    Starting a take only queues it: the capture thread gets the spare
+    buffer ready (or copies the history into it) once the thumbnail
+    builder has let go of it (it may have just been swapped out of a
+    slot), so a press never has to wait.
+
+  ==============================================================================
+*/
+
+#ifndef SAMPLECAPTURE_H_INCLUDED
+#define SAMPLECAPTURE_H_INCLUDED
+
+#include "JuceHeader.h"
+
+// forward declarations
+class AudioSample;
+class CaptureHistory;
+class ThumbnailBuilder;
+
+class SampleCapture : public TimeSliceClient
+{
+public:
+    SampleCapture(TimeSliceThread &thread, const ThumbnailBuilder &builder);
+    ~SampleCapture();
+
+    /* Makes sure the spare buffer can hold a take of this many samples,
+       so that start() doesn't have to allocate. Does nothing if a take is
+       in progress. Never call this from the audio thread.
+    */
+    void reserve(const int &maxLengthInSamples);
+
+    /* Queues a take which will replace the audio of targetSample once
+       it's finished. This doesn't wait, the take starts as soon as the
+       capture thread has the spare buffer ready. Returns false if a take
+       is already queued or in progress. Never call this from the audio
+       thread.
+    */
+    bool start(AudioSample *targetSample, const int &takeLengthInSamples,
+               const int &precountLengthInSamples);
+
+    /* Instead of recording, queues a copy of the last takeLengthInSamples
+       of the history, which the capture thread makes as soon as it can.
+       The audio thread then only has to swap it into the target sample on
+       its next process(). Returns false if a take is already queued or in
+       progress; if there turns out not to be enough history the take is
+       just dropped (and isCapturing() goes false). Never call this from
+       the audio thread.
+    */
+    bool startFromHistory(AudioSample *targetSample, const CaptureHistory &historyToKeep,
+                          const int &takeLengthInSamples);
+
+    /* (audio thread only) Adds numSamples of input to the take. Returns
+       true if this finished the take, in which case the target sample
+       already has the new audio (at sampleRate) and just needs its
+       thumbnail rebuilt.
+    */
+    bool process(const AudioSampleBuffer &input, const int &numSamples, const double &sampleRate);
+
+    bool isCapturing() const { return state.get() != sIdle; }
+
+    // the sample that the current (or last) take replaces
+    AudioSample* getTargetSample() const { return target; }
+
+    // for the GUI: how far through the precount / take we are (0.0 - 1.0)
+    float getPrecountPercent() const;
+    float getPercent() const;
+
+    // TimeSliceClient
+    int useTimeSlice();
+
+private:
+
+    TimeSliceThread &captureThread;
+    const ThumbnailBuilder &thumbnailBuilder;
+
+    enum CaptureState
+    {
+        sIdle,          // the spare buffer can be resized
+        sStarting,      // the spare buffer is being got ready
+        sPending,       // queued, waiting for the thumbnail builder
+        sPrecount,      // waiting for the precount to finish
+        sCapturing,     // writing into the spare buffer
+        sFinished       // the spare buffer is ready to be swapped in
+    };
+    Atomic<int> state;
+
+    // what the next take is written into (this is never null)
+    ScopedPointer<AudioSampleBuffer> spare;
+    AudioSample *target;
+    // what the take is copied from (if it's keeping the last take)
+    const CaptureHistory *history;
+
+    int lengthInSamples, precountLengthInSamples;
+    int position, precountPosition;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SampleCapture);
+};
+
+
+#endif  // SAMPLECAPTURE_H_INCLUDED
@@ -0,0 +1,300 @@
+/*
+  ==============================================================================
+
+    SampleLoader.cpp
+    Created: 18 Oct 2026 8:05:52pm
+    Author:  hemmer
+
+  ==============================================================================
+*/
+
+#include "SampleLoader.h"
+#include "PluginProcessor.h"
+
+SampleLoader::SampleLoader(mlrVSTAudioProcessor * const owner) :
+    processor(owner),
+    // one thread is plenty as loading is mostly waiting for the disk,
+    // and it means files finish in the order they were queued
+    loaderThreads(1),
+    // prefetching shouldn't get in the way of anything else
+    prefetchThreads(1),
+    jobLock(), pendingJobs(),
+    resultLock(), finishedLoads(),
+    progressLock(), currentFile(), currentProgress(0.0f), progressChanged(false),
+    listeners()
+{
+    prefetchThreads.setThreadPriorities(2);
+}
+
+SampleLoader::~SampleLoader()
+{
+    cancelAll();
+    cancelPendingUpdate();
+}
+
+bool SampleLoader::loadSample(const File &sampleFile, const int &targetStripID)
+{
+    // can straight up reject the file if it doesn't have the right extension
+    WildcardFileFilter fileFilter(processor->getWildcardFormats(), " ", "audio files");
+    if (!fileFilter.isFileSuitable(sampleFile))
+    {
+        DBG("Invalid file extension \"" << sampleFile.getFileExtension() << "\", loading aborted");
+        return false;
+    }
+
+    LoadResult existingResult;
+    existingResult.samplePoolIndex = -1;
+
+    {
+        const ScopedLock sl(jobLock);
+
+        // only the newest load for a strip gets to change its sample
+        if (targetStripID >= 0)
+        {
+            for (int j = 0; j < pendingJobs.size(); ++j)
+                if (pendingJobs.getUnchecked(j)->targetStripID == targetStripID)
+                    pendingJobs.getUnchecked(j)->targetStripID = -1;
+        }
+
+        // if the file is already queued, just update where it is going
+        for (int j = 0; j < pendingJobs.size(); ++j)
+        {
+            LoadJob *job = pendingJobs.getUnchecked(j);
+            if (job->sampleFile != sampleFile) continue;
+
+            // ...unless it's a prefetch that hasn't started yet, in which
+            // case it is taken out of the queue and loaded right away
+            if (!job->isPrefetch || targetStripID < 0
+                || !prefetchThreads.removeJob(job, false, 0))
+            {
+                job->targetStripID = targetStripID;
+                return true;
+            }
+
+            break;
+        }
+
+        // if the sample is already loaded, there is nothing to do
+        // but we still let the listeners know
+        const int existingIndex = processor->findSampleInPool(sampleFile);
+        if (existingIndex < 0)
+        {
+            LoadJob *newJob = new LoadJob(*this, sampleFile, targetStripID);
+            pendingJobs.add(newJob);
+            loaderThreads.addJob(newJob, true);
+            return true;
+        }
+
+        DBG("Sample already loaded!");
+        existingResult.sampleFile = sampleFile;
+        existingResult.samplePoolIndex = existingIndex;
+        existingResult.targetStripID = targetStripID;
+    }
+
+    // On the message thread (e.g. switching presets) this is
+    // just a pointer swap, so there is no need to wait.
+    if (MessageManager::getInstance()->isThisTheMessageThread())
+    {
+        applyResult(existingResult);
+    }
+    else
+    {
+        const ScopedLock rl(resultLock);
+        finishedLoads.add(existingResult);
+        triggerAsyncUpdate();
+    }
+
+    return true;
+}
+
+void SampleLoader::prefetchSamples(const Array<File> &sampleFiles, const int64 &memoryBudget)
+{
+    WildcardFileFilter fileFilter(processor->getWildcardFormats(), " ", "audio files");
+
+    const ScopedLock sl(jobLock);
+
+    for (int f = 0; f < sampleFiles.size(); ++f)
+    {
+        const File &sampleFile = sampleFiles.getReference(f);
+
+        if (!fileFilter.isFileSuitable(sampleFile) || !sampleFile.existsAsFile())
+            continue;
+
+        // skip anything that is loaded or on its way
+        bool alreadyQueued = false;
+        for (int j = 0; j < pendingJobs.size() && !alreadyQueued; ++j)
+            alreadyQueued = (pendingJobs.getUnchecked(j)->sampleFile == sampleFile);
+
+        if (alreadyQueued || processor->findSampleInPool(sampleFile) >= 0)
+            continue;
+
+        LoadJob *newJob = new LoadJob(*this, sampleFile, -1, true, memoryBudget);
+        pendingJobs.add(newJob);
+        prefetchThreads.addJob(newJob, true);
+    }
+}
+
+void SampleLoader::cancelStripLoads()
+{
+    {
+        const ScopedLock sl(jobLock);
+        for (int j = 0; j < pendingJobs.size(); ++j)
+            pendingJobs.getUnchecked(j)->targetStripID = -1;
+    }
+
+    const ScopedLock rl(resultLock);
+    for (int r = 0; r < finishedLoads.size(); ++r)
+        finishedLoads.getReference(r).targetStripID = -1;
+}
+
+void SampleLoader::cancelAll()
+{
+    // running jobs are interrupted, queued ones are just deleted
+    prefetchThreads.removeAllJobs(true, 5000);
+    loaderThreads.removeAllJobs(true, 5000);
+}
+
+void SampleLoader::cancelPrefetches()
+{
+    prefetchThreads.removeAllJobs(true, 5000);
+}
+
+int SampleLoader::getNumPendingLoads() const
+{
+    const ScopedLock sl(jobLock);
+    return pendingJobs.size();
+}
+
+void SampleLoader::handleAsyncUpdate()
+{
+    // let the listeners know how the current file is getting on...
+    File progressFile;
+    float progress = 0.0f;
+    bool hasProgress = false;
+    {
+        const ScopedLock sl(progressLock);
+        if (progressChanged)
+        {
+            progressFile = currentFile;
+            progress = currentProgress;
+            hasProgress = true;
+            progressChanged = false;
+        }
+    }
+
+    if (hasProgress)
+        listeners.call(&Listener::sampleLoadProgress, progressFile, progress);
+
+
+    // ...and about any that have finished
+    Array<LoadResult> results;
+    {
+        const ScopedLock sl(resultLock);
+        results.swapWith(finishedLoads);
+    }
+
+    for (int r = 0; r < results.size(); ++r)
+        applyResult(results.getReference(r));
+}
+
+void SampleLoader::applyResult(const LoadResult &result)
+{
+    if (result.samplePoolIndex >= 0 && result.targetStripID >= 0)
+    {
+        const AudioSample *newSample = processor->getAudioSample(result.samplePoolIndex,
+                                                                 mlrVSTAudioProcessor::pSamplePool);
+        processor->setSampleStripParameter(SampleStrip::pAudioSample, newSample, result.targetStripID);
+    }
+
+    listeners.call(&Listener::sampleLoadFinished, result.sampleFile,
+                   result.samplePoolIndex, result.targetStripID);
+}
+
+
+SampleLoader::LoadJob::LoadJob(SampleLoader &owner, const File &fileToLoad, const int &stripID,
+                               const bool &isPrefetchJob, const int64 &prefetchMemoryBudget) :
+    ThreadPoolJob(isPrefetchJob ? "mlrVST sample prefetch" : "mlrVST sample loader"),
+    sampleFile(fileToLoad), targetStripID(stripID),
+    isPrefetch(isPrefetchJob), memoryBudget(prefetchMemoryBudget),
+    loader(owner)
+{
+}
+
+SampleLoader::LoadJob::~LoadJob()
+{
+    // this happens when the job is finished, or if it
+    // is removed from the pool before it gets to run
+    const ScopedLock sl(loader.jobLock);
+    loader.pendingJobs.removeFirstMatchingValue(this);
+}
+
+ThreadPoolJob::JobStatus SampleLoader::LoadJob::runJob()
+{
+    // prefetches stop once we run out of memory (unless a
+    // strip has asked for the sample in the meantime)
+    if (isPrefetch)
+    {
+        int stripID;
+        {
+            const ScopedLock sl(loader.jobLock);
+            stripID = targetStripID;
+        }
+
+        const int64 memoryUsed = loader.processor->getSamplePoolMemoryUsage();
+        const int64 memoryNeeded = AudioSample::estimateMemoryUsage(sampleFile);
+
+        if (stripID < 0 && (memoryNeeded < 0 || memoryUsed + memoryNeeded > memoryBudget))
+        {
+            DBG("Not prefetching " << sampleFile.getFileName() << ", over memory budget");
+            return jobHasFinished;
+        }
+    }
+
+    LoadResult result;
+    result.sampleFile = sampleFile;
+    result.samplePoolIndex = -1;
+
+    setLoadProgress(0.0f);
+
+    try
+    {
+        // decoding and making the thumbnail is the slow part
+        ScopedPointer<AudioSample> newSample(new AudioSample(sampleFile, loader.processor->getThumbnailBuilder(), this,
+                                                             loader.processor->getSampleStreamThread()));
+
+        // the pool takes ownership, and it only becomes visible
+        // to everyone else once it is completely loaded
+        result.samplePoolIndex = loader.processor->addLoadedSample(newSample.release());
+        DBG("Sample Loaded: " + sampleFile.getFileName());
+    }
+    catch (String errString)
+    {
+        DBG(errString);
+    }
+
+    setLoadProgress(1.0f);
+
+    {
+        // read the target last in case it was changed while loading
+        const ScopedLock sl(loader.jobLock);
+        result.targetStripID = targetStripID;
+    }
+
+    const ScopedLock rl(loader.resultLock);
+    loader.finishedLoads.add(result);
+    loader.triggerAsyncUpdate();
+
+    return jobHasFinished;
+}
+
+void SampleLoader::LoadJob::setLoadProgress(const float &progress)
+{
+    {
+        const ScopedLock sl(loader.progressLock);
+        loader.currentFile = sampleFile;
+        loader.currentProgress = progress;
+        loader.progressChanged = true;
+    }
+
+    loader.triggerAsyncUpdate();
+}
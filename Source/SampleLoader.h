@@ -0,0 +1,144 @@
+/*
+  ==============================================================================
+
+    SampleLoader.h
+    Created: 18 Oct 2026 8:05:52pm
+    Author:  hemmer
+
+    Loads samples on a background thread so that dropping files, loading
+    presets etc don't freeze the GUI. Each file is decoded (and has its
+    thumbnail made) by a job, then added to the processor's sample pool in
+    one go. Listeners hear about progress and finished loads on the message
+    thread, and a load can ask for its sample to be put on a strip.
+
+    Samples can also be prefetched (e.g. everything in the setlist) on a
+    second, lower priority, thread. Prefetching stops once the sample pool
+    uses up the memory budget, and anything a strip asks for jumps ahead of
+    the queued prefetches.
+
+  ==============================================================================
+*/
+
+#ifndef SAMPLELOADER_H_INCLUDED
+#define SAMPLELOADER_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "AudioSample.h"
+
+// forward declaration
+class mlrVSTAudioProcessor;
+
+class SampleLoader : private AsyncUpdater
+{
+public:
+    SampleLoader(mlrVSTAudioProcessor * const owner);
+    ~SampleLoader();
+
+    // all callbacks happen on the message thread
+    class Listener
+    {
+    public:
+        virtual ~Listener() {}
+
+        // progress of the file currently being loaded (0 to 1)
+        virtual void sampleLoadProgress(const File &/*sampleFile*/, const float &/*progress*/) {}
+
+        // samplePoolIndex is -1 if the load failed or was cancelled
+        virtual void sampleLoadFinished(const File &sampleFile, const int &samplePoolIndex,
+                                        const int &targetStripID) = 0;
+    };
+
+    void addListener(Listener *listener) { listeners.add(listener); }
+    void removeListener(Listener *listener) { listeners.remove(listener); }
+
+    /* Queues a file to be loaded. If targetStripID is a valid strip, that
+       strip will be given the sample once it has loaded (and any earlier
+       load for the same strip won't be). Files already in the pool or
+       already queued are not loaded twice. Returns false if the file
+       isn't an audio file we can load.
+    */
+    bool loadSample(const File &sampleFile, const int &targetStripID = -1);
+
+    /* Queues files to be loaded in the background (in order) without
+       giving them to any strip. Each is only loaded if the sample pool
+       is using less than memoryBudget bytes when its turn comes.
+    */
+    void prefetchSamples(const Array<File> &sampleFiles, const int64 &memoryBudget);
+
+    /* Stops any queued or finished (but not yet applied) load from being
+       given to a strip, e.g. because a preset has set up the strips since.
+       The files are still loaded into the pool.
+    */
+    void cancelStripLoads();
+
+    // stops any running loads and forgets any queued ones
+    void cancelAll();
+    // the same, but only for prefetches
+    void cancelPrefetches();
+
+    // how many files are queued or loading
+    int getNumPendingLoads() const;
+
+private:
+
+    class LoadJob : public ThreadPoolJob,
+                    public AudioSample::LoadMonitor
+    {
+    public:
+        LoadJob(SampleLoader &owner, const File &fileToLoad, const int &stripID,
+                const bool &isPrefetchJob = false, const int64 &prefetchMemoryBudget = 0);
+        ~LoadJob();
+
+        JobStatus runJob();
+
+        // AudioSample::LoadMonitor
+        void setLoadProgress(const float &progress);
+        bool shouldCancelLoad() { return shouldExit(); }
+
+        const File sampleFile;
+        int targetStripID;      // NOTE: protected by the loader's jobLock
+
+        const bool isPrefetch;
+        const int64 memoryBudget;   // (prefetches only)
+
+    private:
+        SampleLoader &loader;
+
+        JUCE_DECLARE_NON_COPYABLE(LoadJob);
+    };
+
+    struct LoadResult
+    {
+        File sampleFile;
+        int samplePoolIndex, targetStripID;
+    };
+
+    void handleAsyncUpdate();
+    // gives the sample to its strip (if any) and tells the listeners
+    void applyResult(const LoadResult &result);
+
+    mlrVSTAudioProcessor * const processor;
+
+    ThreadPool loaderThreads, prefetchThreads;
+
+    // queued / running jobs (the ThreadPool owns them)
+    CriticalSection jobLock;
+    Array<LoadJob*> pendingJobs;
+
+    // finished loads waiting to be passed to the message thread
+    CriticalSection resultLock;
+    Array<LoadResult> finishedLoads;
+
+    // progress of the current load (for the listeners)
+    CriticalSection progressLock;
+    File currentFile;
+    float currentProgress;
+    bool progressChanged;
+
+    ListenerList<Listener> listeners;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SampleLoader);
+};
+
+
+#endif  // SAMPLELOADER_H_INCLUDED
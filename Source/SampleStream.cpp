@@ -0,0 +1,319 @@
+/*
+  ==============================================================================
+
+    SampleStream.cpp
+    Created: 18 Oct 2026 9:41:18pm
+    Author:  hemmer
+
+  ==============================================================================
+*/
+
+#include "SampleStream.h"
+
+SampleStream::SampleStream(AudioFormatReader *sourceReader, TimeSliceThread &thread) :
+    reader(sourceReader), streamThread(thread), isMappedStream(false),
+    lengthInFrames((int) sourceReader->lengthInSamples),
+    numBlocksInFile(1 + ((int) sourceReader->lengthInSamples - 1) / blockSize),
+    numBlocksLoaded(0),
+    decodeBuffer(2, blockSize)
+{
+    for (int c = 0; c < numCacheBlocks; ++c)
+        cache[c].data.calloc(2 * blockSize);
+
+    initialise();
+}
+
+SampleStream::SampleStream(OwnedArray<MemoryMappedAudioFormatReader> &mappedReaders, TimeSliceThread &thread) :
+    reader(), streamThread(thread), isMappedStream(true),
+    lengthInFrames((int) mappedReaders.getFirst()->lengthInSamples),
+    numBlocksInFile(1 + ((int) mappedReaders.getFirst()->lengthInSamples - 1) / blockSize),
+    numBlocksLoaded(0),
+    decodeBuffer(1, 1)
+{
+    jassert(mappedReaders.size() == numCacheBlocks);
+
+    // (nothing is mapped until it is wanted)
+    for (int c = 0; c < numCacheBlocks; ++c)
+        cache[c].map = mappedReaders[c];
+
+    mappedReaders.clear(false);
+
+    initialise();
+}
+
+void SampleStream::initialise()
+{
+    jassert(lengthInFrames > 0);
+
+    for (int r = 0; r < maxNumReaders; ++r)
+    {
+        readerPositions[r] = -1;
+        readerDirections[r] = 1;
+        readerLastSeen[r] = 0;
+
+        readerFirstChunkStarts[r] = 0;
+        readerChunkSizes[r] = 0;
+        readerNumChunks[r] = 0;
+        readerChunksLastSeen[r] = 0;
+    }
+
+    streamThread.addTimeSliceClient(this);
+}
+
+SampleStream::~SampleStream()
+{
+    // (this waits if the thread is using us)
+    streamThread.removeTimeSliceClient(this);
+}
+
+bool SampleStream::readFrames(float *destL, float *destR,
+                              const int &startFrame, const int &numFrames) const
+{
+    jassert(startFrame >= 0 && startFrame + numFrames <= lengthInFrames);
+
+    bool allCached = true;
+    int numDone = 0;
+
+    while (numDone < numFrames)
+    {
+        const int frame = startFrame + numDone;
+        const int blockIndex = frame / blockSize;
+        const int offset = frame - blockIndex * blockSize;
+        const int numThisBlock = jmin(numFrames - numDone, blockSize - offset);
+
+        const int c = findCachedBlock(blockIndex);
+        const bool copied = (c >= 0) && readCachedBlock(cache[c], blockIndex, destL + numDone,
+                                                        (destR != nullptr) ? destR + numDone : nullptr,
+                                                        frame, numThisBlock);
+
+        if (!copied)
+        {
+            zeromem(destL + numDone, sizeof(float) * (size_t) numThisBlock);
+            if (destR != nullptr)
+                zeromem(destR + numDone, sizeof(float) * (size_t) numThisBlock);
+
+            allCached = false;
+        }
+
+        numDone += numThisBlock;
+    }
+
+    return allCached;
+}
+
+bool SampleStream::readCachedBlock(const CacheBlock &block, const int &blockIndex, float *destL, float *destR,
+                                   const int &startFrame, const int &numFrames) const
+{
+    if (isMappedStream)
+    {
+        // the thread won't move the map while we're reading it
+        ++block.numReaders;
+
+        const bool isMapped = (block.blockIndex.get() == blockIndex);
+        if (isMapped)
+        {
+            // this just converts straight from the mapped file
+            int* chans[2] = { reinterpret_cast<int*> (destL), reinterpret_cast<int*> (destR) };
+            block.map->read(chans, destR != nullptr ? 2 : 1, startFrame, numFrames, true);
+
+            if (!block.map->usesFloatingPointData)
+            {
+                const float multiplier = 1.0f / 0x7fffffff;
+                FloatVectorOperations::convertFixedToFloat(destL, chans[0], multiplier, numFrames);
+                if (destR != nullptr)
+                    FloatVectorOperations::convertFixedToFloat(destR, chans[1], multiplier, numFrames);
+            }
+        }
+
+        --block.numReaders;
+        return isMapped;
+    }
+
+    const int versionBefore = block.version.get();
+    if ((versionBefore & 1) != 0 || block.blockIndex.get() != blockIndex)
+        return false;
+
+    const int offset = startFrame - blockIndex * blockSize;
+    memcpy(destL, block.data + offset, sizeof(float) * (size_t) numFrames);
+    if (destR != nullptr)
+        memcpy(destR, block.data + blockSize + offset, sizeof(float) * (size_t) numFrames);
+
+    // if the thread replaced the block while we
+    // were copying it then what we have is junk
+    return block.version.get() == versionBefore;
+}
+
+void SampleStream::setPlaybackPosition(const int &readerID, const int &position, const bool &isReversed)
+{
+    if (readerID < 0 || readerID >= maxNumReaders) return;
+
+    readerPositions[readerID] = position;
+    readerDirections[readerID] = isReversed ? -1 : 1;
+    readerLastSeen[readerID] = Time::getMillisecondCounter();
+}
+
+void SampleStream::setChunkStarts(const int &readerID, const int &firstChunkStart,
+                                  const int &chunkSize, const int &numChunks)
+{
+    if (readerID < 0 || readerID >= maxNumReaders) return;
+
+    readerFirstChunkStarts[readerID] = firstChunkStart;
+    readerChunkSizes[readerID] = chunkSize;
+    readerNumChunks[readerID] = numChunks;
+    readerChunksLastSeen[readerID] = Time::getMillisecondCounter();
+}
+
+int SampleStream::useTimeSlice()
+{
+    const uint32 now = Time::getMillisecondCounter();
+
+    // Work out which blocks are needed, most urgent first: the block
+    // each strip is playing, then the ones ahead, then the ones behind.
+    Array<int> wantedBlocks;
+
+    for (int step = 0; step <= blocksAhead + blocksBehind; ++step)
+    {
+        const int blockOffset = (step <= blocksAhead) ? step : blocksAhead - step;
+
+        for (int r = 0; r < maxNumReaders; ++r)
+        {
+            const int position = readerPositions[r].get();
+            if (position < 0 || now - readerLastSeen[r].get() > (uint32) readerTimeoutMs)
+                continue;
+
+            const int blockIndex = position / blockSize + blockOffset * readerDirections[r].get();
+
+            if (blockIndex >= 0 && blockIndex < numBlocksInFile)
+                wantedBlocks.addIfNotAlreadyThere(blockIndex);
+        }
+    }
+
+    // strips usually start from the start, so have that ready too
+    wantedBlocks.addIfNotAlreadyThere(0);
+
+    // Then the start of every chunk (and the end of the last one, for
+    // reversed strips), taking the first chunk of each strip, then the
+    // second etc, until the cache is full.
+    for (int chunk = 0; wantedBlocks.size() < numCacheBlocks; ++chunk)
+    {
+        bool anyLeft = false;
+
+        for (int r = 0; r < maxNumReaders; ++r)
+        {
+            if (chunk > readerNumChunks[r].get() || readerChunkSizes[r].get() <= 0
+                || now - readerChunksLastSeen[r].get() > (uint32) readerTimeoutMs)
+                continue;
+
+            anyLeft = true;
+
+            const int chunkStart = readerFirstChunkStarts[r].get() + chunk * readerChunkSizes[r].get();
+            const int blockIndex = jlimit(0, lengthInFrames - 1, chunkStart) / blockSize;
+            wantedBlocks.addIfNotAlreadyThere(blockIndex);
+        }
+
+        if (!anyLeft) break;
+    }
+
+    wantedBlocks.resize(jmin(wantedBlocks.size(), (int) numCacheBlocks));
+
+    for (int w = 0; w < wantedBlocks.size(); ++w)
+    {
+        const int blockIndex = wantedBlocks.getUnchecked(w);
+        if (findCachedBlock(blockIndex) >= 0) continue;
+
+        const int cacheIndex = findBlockToReplace(wantedBlocks);
+        if (cacheIndex < 0) break;
+
+        // come straight back for the next one (unless that failed)
+        return loadBlock(cacheIndex, blockIndex) ? 0 : 20;
+    }
+
+    // nothing to do for now
+    return 20;
+}
+
+int SampleStream::findCachedBlock(const int &blockIndex) const
+{
+    for (int c = 0; c < numCacheBlocks; ++c)
+        if (cache[c].blockIndex.get() == blockIndex)
+            return c;
+
+    return -1;
+}
+
+int SampleStream::findBlockToReplace(const Array<int> &wantedBlocks) const
+{
+    int oldest = -1;
+
+    for (int c = 0; c < numCacheBlocks; ++c)
+    {
+        const int blockIndex = cache[c].blockIndex.get();
+
+        if (blockIndex < 0)
+            return c;
+
+        if (wantedBlocks.contains(blockIndex))
+            continue;
+
+        if (oldest < 0 || cache[c].loadOrder < cache[oldest].loadOrder)
+            oldest = c;
+    }
+
+    return oldest;
+}
+
+bool SampleStream::loadBlock(const int &cacheIndex, const int &blockIndex)
+{
+    CacheBlock &block = cache[cacheIndex];
+
+    const int startFrame = blockIndex * blockSize;
+    const int numFrames = jmin((int) blockSize, lengthInFrames - startFrame);
+
+    if (isMappedStream)
+    {
+        // take the block out of use, and wait for anyone still reading it
+        ++block.version;
+        block.blockIndex = -1;
+
+        while (block.numReaders.get() > 0)
+            Thread::yield();
+
+        // NOTE: mapping can fail if we run out of address space
+        const bool isMapped = block.map->mapSectionOfFile(Range<int64> (startFrame, startFrame + numFrames));
+
+        if (isMapped)
+        {
+            // page the block in here, rather than on the audio thread
+            for (int f = startFrame; f < startFrame + numFrames; f += framesPerTouch)
+                block.map->touchSample(f);
+
+            block.blockIndex = blockIndex;
+            block.loadOrder = ++numBlocksLoaded;
+        }
+        else
+        {
+            DBG("Couldn't map block " << blockIndex << " of " << block.map->getFile().getFileName());
+        }
+
+        ++block.version;
+        return isMapped;
+    }
+
+    // decode before touching the cache so it is only
+    // unavailable for as long as the copy takes
+    reader->read(&decodeBuffer, 0, numFrames, startFrame, true, true);
+
+    // mark the block as changing (odd version)...
+    ++block.version;
+    block.blockIndex = -1;
+
+    memcpy(block.data, decodeBuffer.getSampleData(0), sizeof(float) * (size_t) numFrames);
+    memcpy(block.data + blockSize, decodeBuffer.getSampleData(1), sizeof(float) * (size_t) numFrames);
+
+    block.blockIndex = blockIndex;
+    block.loadOrder = ++numBlocksLoaded;
+
+    // ...and ready again
+    ++block.version;
+    return true;
+}
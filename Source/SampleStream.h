@@ -0,0 +1,115 @@
+/*
+  ==============================================================================
+
+    SampleStream.h
+    Created: 18 Oct 2026 9:41:18pm
+    Author:  hemmer
+
+    Plays long files without loading them completely. Compressed files are
+    decoded a block at a time (on a shared TimeSliceThread) into a small
+    cache, uncompressed ones just have each cache block memory mapped. The
+    blocks kept are the ones around where each strip using the sample is
+    playing, plus the start of each of their chunks (so presses don't have
+    to wait for the disk). The audio thread never waits for the disk: it
+    reads whatever is cached and anything that isn't is silent.
+
+  ==============================================================================
+*/
+
+#ifndef SAMPLESTREAM_H_INCLUDED
+#define SAMPLESTREAM_H_INCLUDED
+
+#include "JuceHeader.h"
+
+
+class SampleStream : public TimeSliceClient
+{
+public:
+    // takes ownership of the reader, which is only ever used by the thread
+    SampleStream(AudioFormatReader *sourceReader, TimeSliceThread &thread);
+    // Maps the blocks instead of decoding them, using one reader for each
+    // cache block (which must all be for the same file). Takes the readers.
+    SampleStream(OwnedArray<MemoryMappedAudioFormatReader> &mappedReaders, TimeSliceThread &thread);
+    ~SampleStream();
+
+    enum
+    {
+        blockSize = 1 << 15,    // frames in each cache block
+        numCacheBlocks = 32,    // so about 8MB of (stereo) cache per stream
+        blocksAhead = 3,        // how far ahead of each strip we decode...
+        blocksBehind = 1,       // ...and what we keep behind it
+        maxNumReaders = 32,     // strip IDs above this aren't followed
+        readerTimeoutMs = 1000, // forget strips we haven't heard from in this long
+        framesPerTouch = 512    // (at most a page) when paging in a mapped block
+    };
+
+    /* Copies frames from the cache (destR can be null). This doesn't lock
+       so can be called from the audio thread, frames that aren't cached
+       are zeroed. Returns false if anything was missing.
+    */
+    bool readFrames(float *destL, float *destR, const int &startFrame, const int &numFrames) const;
+
+    // called by each strip as it plays so we know what to decode next
+    void setPlaybackPosition(const int &readerID, const int &position, const bool &isReversed);
+    // called by each strip using the sample so the start of its chunks are ready
+    void setChunkStarts(const int &readerID, const int &firstChunkStart,
+                        const int &chunkSize, const int &numChunks);
+
+    bool isMapped() const { return isMappedStream; }
+
+    // TimeSliceClient
+    int useTimeSlice();
+
+private:
+
+    struct CacheBlock
+    {
+        CacheBlock() : data(), map(), blockIndex(-1), version(0), numReaders(0), loadOrder(0) {}
+
+        HeapBlock<float> data;  // left channel then right channel
+        // (for mapped streams the block is read from here instead)
+        ScopedPointer<MemoryMappedAudioFormatReader> map;
+        Atomic<int> blockIndex; // which block of the file this is (or -1)
+        Atomic<int> version;    // odd while the block is being replaced
+        mutable Atomic<int> numReaders; // threads reading the map (it can't move until 0)
+        uint32 loadOrder;       // (only used by the thread)
+    };
+
+    // copies part of a block if it is still cached
+    bool readCachedBlock(const CacheBlock &block, const int &blockIndex, float *destL, float *destR,
+                         const int &startFrame, const int &numFrames) const;
+
+    int findCachedBlock(const int &blockIndex) const;
+    // an empty cache block or the oldest one that isn't wanted, -1 if none
+    int findBlockToReplace(const Array<int> &wantedBlocks) const;
+    // returns false if the block couldn't be loaded
+    bool loadBlock(const int &cacheIndex, const int &blockIndex);
+    // sets up the reader positions etc
+    void initialise();
+
+    ScopedPointer<AudioFormatReader> reader;
+    TimeSliceThread &streamThread;
+    const bool isMappedStream;
+    const int lengthInFrames, numBlocksInFile;
+
+    CacheBlock cache[numCacheBlocks];
+    uint32 numBlocksLoaded;
+
+    // where each strip is playing (-1 if it isn't)
+    Atomic<int> readerPositions[maxNumReaders];
+    Atomic<int> readerDirections[maxNumReaders];
+    Atomic<uint32> readerLastSeen[maxNumReaders];
+    // and where each strip's chunks start
+    Atomic<int> readerFirstChunkStarts[maxNumReaders];
+    Atomic<int> readerChunkSizes[maxNumReaders];
+    Atomic<int> readerNumChunks[maxNumReaders];
+    Atomic<uint32> readerChunksLastSeen[maxNumReaders];
+
+    // the reader decodes into here first (not used for mapped streams)
+    AudioSampleBuffer decodeBuffer;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SampleStream);
+};
+
+
+#endif  // SAMPLESTREAM_H_INCLUDED
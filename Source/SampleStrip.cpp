@@ -13,13 +13,14 @@
 #include "PluginProcessor.h"
 #include "Utilities.h"
 #include "GlobalSettings.h"
+#include "RenderKernels.h"
 
 SampleStrip::SampleStrip(const int &newID, mlrVSTAudioProcessor *owner) :
 
     // meta data /////////////////////////////////////////////
     sampleStripID(newID),
     // communication //////////////////////////
-    parent(owner),
+    parent(owner), changeCount(0),
     // playback parameters //////////////////////////////////////
     currentChannel(0), playbackPercentage(0.0), currentPlayMode(LOOP),
     isPlaying(false), isReversed(false), isLatched(true),
@@ -33,6 +34,8 @@ SampleStrip::SampleStrip(const int &newID, mlrVSTAudioProcessor *owner) :
     volumeIncreasing(false), volumeDecreasing(false), stripVolume(1.0f),
     playSpeedIncreasing(false), playSpeedDecreasing(false), playSpeed(1.0),
     isPlaySpeedLocked(false), previousBPM(120.0),
+    interpolationMode(RenderKernels::iLinear),
+    streamWindow(2, streamWindowSize),
     // starting / stopping ////////////////////////////////////
     rampLength(50),
     playbackStarting(false), startVol(0.0f), startVolInc(1.0f / (float) rampLength),
@@ -40,7 +43,9 @@ SampleStrip::SampleStrip(const int &newID, mlrVSTAudioProcessor *owner) :
     stopMode(mStopNormal), tapeStopSpeed(1.0f),
 
     // misc ///////////////////////////////////////////////////
-    buttonStatus()
+    buttonStatus(),
+    // thread handoff /////////////////////////////////////////
+    pendingChangeFifo(pendingChangeQueueSize)
 
 {
     for (int i = 0; i < NUM_COLS; ++i) buttonStatus.add(false);
@@ -51,6 +56,27 @@ SampleStrip::SampleStrip(const int &newID, mlrVSTAudioProcessor *owner) :
 void SampleStrip::setSampleStripParam(const int &parameterID, const void *newValue,
                                       const bool &sendChangeMsg)
 {
+    // if we're not on the audio thread, let it make the change
+    if (!canApplyChangeNow())
+    {
+        PendingChange change(cSetParam);
+        change.parameterID = parameterID;
+        change.sendChangeMsg = sendChangeMsg;
+
+        switch (getParameterType(parameterID))
+        {
+        case TypeInt : change.intValue = *static_cast<const int*>(newValue); break;
+        case TypeDouble : change.doubleValue = *static_cast<const double*>(newValue); break;
+        case TypeFloat : change.floatValue = *static_cast<const float*>(newValue); break;
+        case TypeBool : change.boolValue = *static_cast<const bool*>(newValue); break;
+        case TypeAudioSample : change.sampleValue = static_cast<const AudioSample*>(newValue); break;
+        default : jassertfalse; return;
+        }
+
+        queueChange(change);
+        return;
+    }
+
     /////////////////////////////////////////////////////
     // TODO: optimise switch case by order of importance!
 
@@ -58,7 +84,7 @@ void SampleStrip::setSampleStripParam(const int &parameterID, const void *newVal
     {
     case pCurrentChannel :
         {
-            const int numChannels = *static_cast<const int*>(parent->getGlobalSetting(GlobalSettings::sNumChannels));
+            const int numChannels = parent->getGlobalSetting<GlobalSettings::sNumChannels>();
             const int newChannel = *static_cast<const int*>(newValue);
 
             // check that the new channel is range
@@ -170,6 +196,11 @@ void SampleStrip::setSampleStripParam(const int &parameterID, const void *newVal
     case pRampLength :
         rampLength = *static_cast<const int*>(newValue); break;
 
+    case pInterpolation :
+        interpolationMode = jlimit(0, (int) RenderKernels::NumInterpolationModes - 1,
+                                   *static_cast<const int*>(newValue));
+        break;
+
     case pFractionalStart :
         {
             fractionalSampleStart = *static_cast<const float*>(newValue);
@@ -210,7 +241,7 @@ void SampleStrip::setSampleStripParam(const int &parameterID, const void *newVal
     // notify listeners of changes if requested
     if (sendChangeMsg)
     {
-        sendChangeMessage();
+        markChanged();
     }
 }
 const void* SampleStrip::getSampleStripParam(const int &parameterID) const
@@ -277,6 +308,8 @@ const void* SampleStrip::getSampleStripParam(const int &parameterID) const
         p = &fractionalSampleStart; break;
     case pFractionalEnd :
         p = &fractionalSampleEnd; break;
+    case pInterpolation :
+        p = &interpolationMode; break;
     case pStripID :
         p = &sampleStripID; break;
 
@@ -291,6 +324,15 @@ const void* SampleStrip::getSampleStripParam(const int &parameterID) const
 
 void SampleStrip::toggleSampleStripParam(const int &parameterID, const bool &sendChangeMsg)
 {
+    if (!canApplyChangeNow())
+    {
+        PendingChange change(cToggleParam);
+        change.parameterID = parameterID;
+        change.sendChangeMsg = sendChangeMsg;
+        queueChange(change);
+        return;
+    }
+
     switch (parameterID)
     {
     case pIsPlaying :
@@ -323,13 +365,13 @@ void SampleStrip::toggleSampleStripParam(const int &parameterID, const bool &sen
 
     // notify listeners of changes if requested
     if (sendChangeMsg)
-        sendChangeMessage();
+        markChanged();
 
 }
 
 void SampleStrip::cycleChannels()
 {
-    const int numChannels = *static_cast<const int *>(parent->getGlobalSetting(GlobalSettings::sNumChannels));
+    const int numChannels = parent->getGlobalSetting<GlobalSettings::sNumChannels>();
 	const int nextChannel = (currentChannel + 1) % numChannels;
 
 	setSampleStripParam(pCurrentChannel, &nextChannel, true);
@@ -337,6 +379,14 @@ void SampleStrip::cycleChannels()
 
 void SampleStrip::updatePlaySpeedForBPMChange(const double &newBPM)
 {
+    if (!canApplyChangeNow())
+    {
+        PendingChange change(cBPMChange);
+        change.doubleValue = newBPM;
+        queueChange(change);
+        return;
+    }
+
     if (!isPlaySpeedLocked && currentSample != nullptr)
     {
         playSpeed *= (newBPM / previousBPM);
@@ -344,11 +394,17 @@ void SampleStrip::updatePlaySpeedForBPMChange(const double &newBPM)
     }
 
     // let any listeners (i.e. GUI) know of the change
-    sendChangeMessage();
+    markChanged();
 }
 
 void SampleStrip::updatePlaySpeedForSelectionChange()
 {
+    if (!canApplyChangeNow())
+    {
+        queueChange(PendingChange(cSelectionChange));
+        return;
+    }
+
     if (!isPlaySpeedLocked && currentSample != nullptr && selectionLength > 0)
     {
         jassert(previousSelectionLength > 0);
@@ -357,7 +413,7 @@ void SampleStrip::updatePlaySpeedForSelectionChange()
     }
 
     // let any listeners (i.e. GUI) know of the change
-    sendChangeMessage();
+    markChanged();
 }
 
 double SampleStrip::findInitialPlaySpeed(const double &newBPM, const float &hostSampleRate, const bool &applyChange)
@@ -365,17 +421,10 @@ double SampleStrip::findInitialPlaySpeed(const double &newBPM, const float &host
     if (currentSample != nullptr)
     {
         double numSamplesInFourBars = ((newBPM / 960.0) * hostSampleRate);
-        playSpeed = (double)(selectionLength / sampleSampleRate) * (numSamplesInFourBars / hostSampleRate);
-
-        /* This uses multiples of two to find the closest speed to 1.0,
-           and sets the tempo to use in updatePlaySpeedForBPMChange()
-           and updatePlaySpeedForSelectionChange()
-        */
-        previousBPM = newBPM;
-        previousSelectionLength = selectionLength;
+        const double fourBarPlaySpeed = (double)(selectionLength / currentSample->getSampleRate()) * (numSamplesInFourBars / hostSampleRate);
 
-        double newPlaySpeed = playSpeed;
-        if (playSpeed > 1.0)
+        double newPlaySpeed = fourBarPlaySpeed;
+        if (fourBarPlaySpeed > 1.0)
         {
             while ( fabs(newPlaySpeed / 2.0 - 1.0) < fabs(newPlaySpeed - 1.0) )
             {
@@ -390,13 +439,35 @@ double SampleStrip::findInitialPlaySpeed(const double &newBPM, const float &host
             }
         }
 
+        // the audio thread will repeat this using the up to date
+        // selection, so this return value is only a best guess
+        if (!canApplyChangeNow())
+        {
+            PendingChange change(cInitialPlaySpeed);
+            change.doubleValue = newBPM;
+            change.floatValue = hostSampleRate;
+            change.boolValue = applyChange;
+            queueChange(change);
+
+            return newPlaySpeed;
+        }
+
+        playSpeed = fourBarPlaySpeed;
+
+        /* This uses multiples of two to find the closest speed to 1.0,
+           and sets the tempo to use in updatePlaySpeedForBPMChange()
+           and updatePlaySpeedForSelectionChange()
+        */
+        previousBPM = newBPM;
+        previousSelectionLength = selectionLength;
+
         // if told, update the playspeed to this new tempo
         if (applyChange)
         {
             playSpeed = newPlaySpeed;
 
             // let any listeners (i.e. GUI) know of the change
-            sendChangeMessage();
+            markChanged();
         }
 
         return newPlaySpeed;
@@ -410,17 +481,135 @@ double SampleStrip::findInitialPlaySpeed(const double &newBPM, const float &host
 
 void SampleStrip::modPlaySpeed(const double &factor)
 {
+    if (!canApplyChangeNow())
+    {
+        PendingChange change(cModPlaySpeed);
+        change.doubleValue = factor;
+        queueChange(change);
+        return;
+    }
+
     playSpeed *= factor;
 
     // let listeners know!
-    sendChangeMessage();
+    markChanged();
 }
 
 
 
 
 
-void SampleStrip::handleMidiEvent (const MidiMessage& m)
+// //////////////////////////////////
+// Passing changes between threads //
+bool SampleStrip::canApplyChangeNow() const
+{
+    return parent->isAudioThread();
+}
+
+void SampleStrip::queueChange(const PendingChange &change)
+{
+    {
+        // several threads may be queuing changes, but the
+        // audio thread doesn't have to wait for this lock
+        const ScopedLock sl (producerLock);
+
+        int start1, size1, start2, size2;
+        pendingChangeFifo.prepareToWrite(1, start1, size1, start2, size2);
+
+        // If the queue is full, give the audio thread a chance to catch up
+        // and if it doesn't, apply what's there ourselves. Either way the
+        // change is never lost.
+        for (int numWaits = 0; size1 + size2 == 0; ++numWaits)
+        {
+            if (numWaits < maxQueueFullWait && parent->isAudioRunning())
+                Thread::sleep(1);
+            else
+            {
+                DBG("STRIP " << sampleStripID << ": change queue full, flushing");
+                parent->flushSampleStripChanges();
+            }
+
+            pendingChangeFifo.prepareToWrite(1, start1, size1, start2, size2);
+        }
+
+        pendingChanges[(size1 > 0) ? start1 : start2] = change;
+        pendingChangeFifo.finishedWrite(1);
+    }
+
+    // With no audio running, nothing would collect this (and until then
+    // the getters would return the old values), so apply it now.
+    if (!parent->isAudioRunning())
+        parent->flushSampleStripChanges();
+}
+
+void SampleStrip::applyPendingChanges()
+{
+    jassert(canApplyChangeNow());
+
+    int start1, size1, start2, size2;
+    pendingChangeFifo.prepareToRead(pendingChangeFifo.getNumReady(), start1, size1, start2, size2);
+
+    for (int i = 0; i < size1; ++i)
+        applyChange(pendingChanges[start1 + i]);
+    for (int i = 0; i < size2; ++i)
+        applyChange(pendingChanges[start2 + i]);
+
+    pendingChangeFifo.finishedRead(size1 + size2);
+
+    // whoever queued these changes (e.g. loading a preset) may have
+    // already updated their listeners, so let them know it's done
+    if (size1 + size2 > 0)
+        markChanged();
+}
+
+void SampleStrip::applyChange(const PendingChange &change)
+{
+    switch (change.type)
+    {
+    case cSetParam :
+        {
+            const void *newValue;
+
+            switch (getParameterType(change.parameterID))
+            {
+            case TypeInt : newValue = &change.intValue; break;
+            case TypeDouble : newValue = &change.doubleValue; break;
+            case TypeFloat : newValue = &change.floatValue; break;
+            case TypeBool : newValue = &change.boolValue; break;
+            case TypeAudioSample : newValue = change.sampleValue; break;
+            default : jassertfalse; return;
+            }
+
+            setSampleStripParam(change.parameterID, newValue, change.sendChangeMsg);
+            break;
+        }
+
+    case cToggleParam :
+        toggleSampleStripParam(change.parameterID, change.sendChangeMsg); break;
+
+    case cModPlaySpeed :
+        modPlaySpeed(change.doubleValue); break;
+
+    case cStopPlaying :
+        stopSamplePlaying(change.intValue); break;
+
+    case cBPMChange :
+        updatePlaySpeedForBPMChange(change.doubleValue); break;
+
+    case cSelectionChange :
+        updatePlaySpeedForSelectionChange(); break;
+
+    case cInitialPlaySpeed :
+        findInitialPlaySpeed(change.doubleValue, change.floatValue, change.boolValue); break;
+
+    default :
+        jassertfalse;
+    }
+}
+
+
+
+void SampleStrip::handleNoteEvent(const int &monomeCol, const bool &state)
 {
     /* Due to the design of JUCE, for now OSC messages are handled
        as MIDI messages. The spec is:
@@ -436,16 +625,16 @@ void SampleStrip::handleMidiEvent (const MidiMessage& m)
        from a different strip.
     */
 
-    // find if it is a button up /down press
-    const bool state = m.isNoteOn();
-    const int monomeCol = m.getNoteNumber();
     // if (state) {DBG(sampleStripID << " note on col " << monomeCol);}
     // else {DBG(sampleStripID << " note off col " << monomeCol);}
 
+    if (state)
+        parent->getTraceRecorder().record(TraceRecorder::evNoteRendered, sampleStripID, monomeCol);
+
 
     // Check this button associated with this MIDI message
     // is within the size of the specified device
-    const int numMonomeCols = *static_cast<const int *>(parent->getGlobalSetting(GlobalSettings::sNumMonomeCols));
+    const int numMonomeCols = parent->getGlobalSetting<GlobalSettings::sNumMonomeCols>();
     // and if not skip this MIDI message
     if (monomeCol >= numMonomeCols || monomeCol < 0) return;
 
@@ -513,81 +702,78 @@ void SampleStrip::handleMidiEvent (const MidiMessage& m)
 
 
 void SampleStrip::renderNextBlock(AudioSampleBuffer& outputBuffer,
-                                   const MidiBuffer& midiData,
+                                   const StripEventRouter &events,
                                    int startSample,
                                    int numSamples)
 {
-    // TODO: there is a lot that isn't quite right here!!!!
-    // useEvent is always false it seems
-
     // must set the sample rate before using this!
     //jassert (sampleRate != 0);
 
-    const ScopedLock sl (lock);
-
-    MidiBuffer::Iterator midiIterator(midiData);
-    // only interested in MIDI data
-    midiIterator.setNextSamplePosition(startSample);
-    MidiMessage m(0xf4, 0.0);
-
-    while (numSamples > 0)
-    {
-        int midiEventPos;
-        // try to find a corresponding MIDI event and see if it's within range
-        // and is the correct channel
-        bool useEvent = false;
-
-
-        // look for events in the queue and get the next one (if it exists)
-        while (midiIterator.getNextEvent(m, midiEventPos) )
-        {
-            // we are only interested in note on/off messages,
-            // as other types of message may crash the VST
-            if (!m.isNoteOnOrOff()) continue;
+    // so samples that aren't in memory have the start of each chunk ready
+    if (currentSample != nullptr && !currentSample->isInMemory())
+        currentSample->setChunkStarts(sampleStripID, selectionStart, chunkSize, numChunks);
 
-            // First get the sample strip from the channel
-            const int stripRow = m.getChannel() - 1;
-            // and get the channel associated with that sample strip
-            const int messageSelChannel = *static_cast<const int*>
-                (parent->getSampleStrip(stripRow)->getSampleStripParam(SampleStrip::pCurrentChannel));
+    // the processor has already sorted this block's notes into those
+    // for this strip, and those for any strip on the same channel
+    const Array<StripEventRouter::Event> &stripEvents = events.getStripEvents(sampleStripID);
+    const Array<StripEventRouter::Event> &channelEvents = events.getChannelEvents(currentChannel);
+    int nextStripEvent = 0, nextChannelEvent = 0;
 
+    const int endSample = startSample + numSamples;
 
-            // If the midi message is associated with different strip
-            if (stripRow != sampleStripID)
-            {
-                // and that strip is using the same channel then stop THIS strip from playing.
-                if ((messageSelChannel == currentChannel) && isPlaying && (midiEventPos < startSample + numSamples))
-                    stopSamplePlaying();
+    // skip anything from before this section
+    while (nextStripEvent < stripEvents.size()
+           && stripEvents.getReference(nextStripEvent).position < startSample) ++nextStripEvent;
+    while (nextChannelEvent < channelEvents.size()
+           && channelEvents.getReference(nextChannelEvent).position < startSample) ++nextChannelEvent;
 
-                // As the midi message is from a different strip, then it
-                // is of no use here so we keep looking.
-                continue;
-            }
+    while (numSamples > 0)
+    {
+        // our own notes are on the channel list too, so skip those
+        while (nextChannelEvent < channelEvents.size()
+               && channelEvents.getReference(nextChannelEvent).stripID == sampleStripID) ++nextChannelEvent;
 
+        const StripEventRouter::Event *stripEvent = (nextStripEvent < stripEvents.size())
+            ? &stripEvents.getReference(nextStripEvent) : nullptr;
+        const StripEventRouter::Event *channelEvent = (nextChannelEvent < channelEvents.size())
+            ? &channelEvents.getReference(nextChannelEvent) : nullptr;
 
-            // if the event is usable
-            if (midiEventPos < startSample + numSamples)
-                useEvent = true;
+        // find which comes first (keeping the order of the original MIDI)
+        const bool useStripEvent = stripEvent != nullptr
+            && (channelEvent == nullptr || stripEvent->order < channelEvent->order);
+        const StripEventRouter::Event *nextEvent = useStripEvent ? stripEvent : channelEvent;
 
-            // stop looking (for now) and process the message
-            break;
-        }
+        // is the event usable (i.e. in range)
+        const bool useEvent = nextEvent != nullptr && nextEvent->position < endSample;
 
         // if there was an event, process up until that position
         // otherwise process until the end
-        const int numThisTime = useEvent ? midiEventPos - startSample
+        const int numThisTime = useEvent ? jmax(0, nextEvent->position - startSample)
                                          : numSamples;
 
         if (numThisTime > 0)
         {
             // if we are only rendering up to a certain point AND that
             // point is a new noteOn event, then let the renderer know
-            const bool isFollowedByNoteOn = useEvent && m.isNoteOn();
+            const bool isFollowedByNoteOn = useEvent && useStripEvent && nextEvent->isNoteOn;
             renderNextSection(outputBuffer, startSample, numThisTime, isFollowedByNoteOn);
         }
 
         if (useEvent)
-            handleMidiEvent(m);
+        {
+            if (useStripEvent)
+            {
+                handleNoteEvent(nextEvent->column, nextEvent->isNoteOn);
+                ++nextStripEvent;
+            }
+            else
+            {
+                // The note is for a different strip using the same
+                // channel so stop THIS strip from playing.
+                if (isPlaying) stopSamplePlaying();
+                ++nextChannelEvent;
+            }
+        }
 
         startSample += numThisTime;
         numSamples -= numThisTime;
@@ -604,90 +790,192 @@ void SampleStrip::renderNextSection(AudioSampleBuffer& outputBuffer, int startSa
     {
         updatePlayParams();
 
-        const float* const inL = currentSample->getAudioData()->getSampleData(0, 0);
-        const float* const inR = currentSample->getNumChannels() > 1
-            ? currentSample->getAudioData()->getSampleData(1, 0) : nullptr;
+        // in memory samples are read directly, otherwise
+        // each run is read into the streamWindow first
+        const bool readDirectly = currentSample->isInMemory();
+        const int inLength = currentSample->getSampleLength();
+        const bool isStereo = currentSample->getNumChannels() > 1;
+
+        const float* inL = streamWindow.getSampleData(0, 0);
+        const float* inR = isStereo ? streamWindow.getSampleData(1, 0) : nullptr;
+
+        if (readDirectly)
+        {
+            const AudioSampleBuffer* const sampleData = currentSample->getAudioData();
+            inL = sampleData->getSampleData(0, 0);
+            inR = isStereo ? sampleData->getSampleData(1, 0) : nullptr;
+        }
+        else
+        {
+            // so streamed samples know what to decode next
+            currentSample->setPlaybackPosition(sampleStripID, (int) sampleCurrentPosition, isReversed);
+        }
+
+        // the sample may not be at the host's sample rate, so adjust the
+        // playback speed to compensate (1.0 means the original pitch)
+        const double hostSampleRate = parent->getSampleRate();
+        const double sampleRate = currentSample->getSampleRate();
+        const double sampleRateRatio = (hostSampleRate > 0.0 && sampleRate > 0.0)
+            ? sampleRate / hostSampleRate : 1.0;
 
         float* outL = outputBuffer.getSampleData(0, startSample);
         float* outR = outputBuffer.getNumChannels() > 1 ? outputBuffer.getSampleData (1, startSample) : nullptr;
 
-        while (--numSamples >= 0)
+        /* Rather than checking the ramps / loop points every sample, the
+           section is split into runs over which none of these change. Each
+           run is rendered in one go, then the usual per-sample logic is
+           applied for the last sample of the run (which is where any ramp
+           finishes, loop point is crossed, etc).
+        */
+        while (numSamples > 0 && isPlaying)
         {
-            // just using a simple linear interpolation here..
-            const int pos = (int) sampleCurrentPosition;
-            const double alpha = (double) (sampleCurrentPosition - pos);
-            const double invAlpha = 1.0f - alpha;
+            // stop without any volume ramp (bad idea generally
+            // as you get pops and clicks)
+            if (playbackStopping && stopMode == mStopInstant)
+            {
+                const bool newPlayStatus = false;
+                setSampleStripParam(pIsPlaying, &newPlayStatus);
+                break;
+            }
 
-            // double up if mono
-            float l = (float)(inL [pos] * invAlpha + inL [pos + 1] * alpha);
-            float r = (inR != nullptr) ? (float)(inR [pos] * invAlpha + inR [pos + 1] * alpha) : l;
+            // the speed changes every sample when simulating
+            // a tape stop so these are done one at a time
+            const bool isTapeStopping = playbackStopping && stopMode == mStopTape;
 
-            /* TODO: temporary hack to fix pop. This seems to happen when the pointer
-               deferences something not part of the sample by mistake, leading to a value
-               of order 1000000! This fix will do in lieu of a proper solution:
-            */
-            if (l < -1.0f || l > 1.0f || !isPlaying) l = 0.0f;
-            if (r < -1.0f || r > 1.0f || !isPlaying) r = 0.0f;
+            float envStart = 1.0f, envIncrement = 0.0f;
+            int numThisRun = numSamples;
+
+            if (isTapeStopping)
+            {
+                // linear speed decrease
+                tapeStopSpeed -= 0.0001f;
+                // with a volume ramp at the end
+                if (tapeStopSpeed < 0.25f)
+                    stopVol = 4.0f * tapeStopSpeed;
+
+                envStart = stopVol;
+                numThisRun = 1;
+            }
+            else if (playbackStopping)
+            {
+                envStart = stopVol;
+                envIncrement = -stopVolDec;
+                // finish on the sample where the volume ramp ends
+                numThisRun = samplesUntilCrossing(stopVol, stopVolDec, numThisRun);
+            }
+            else if (playbackStarting)
+            {
+                // (the kernel clamps the envelope at 1 so
+                // this doesn't need to end the run)
+                envStart = startVol;
+                envIncrement = startVolInc;
+            }
+
+            // this is how much the playback position (in/de)creases for each output sample
+            const double playIncrement = playSpeed * tapeStopSpeed * sampleRateRatio;
+
+            if (playIncrement != 0.0 && numThisRun > 1)
+            {
+                const double absIncrement = abs(playIncrement);
+
+                // Crossing the end of the loop / chunk. If we are already
+                // stopping normally then (unless looping) this does nothing.
+                if (currentPlayMode == LOOP || !playbackStopping || stopMode != mStopNormal)
+                {
+                    double boundary = playbackEndPosition;
+                    if (currentPlayMode == PLAY_CHUNK_ONCE)
+                        boundary = selectionStart + (initialColumn + (isReversed ? -1 : 1)) * chunkSize;
+
+                    const double distanceToBoundary = isReversed ? sampleCurrentPosition - boundary
+                                                                 : boundary - sampleCurrentPosition;
+
+                    numThisRun = samplesUntilCrossing(distanceToBoundary, absIncrement, numThisRun);
+                }
+
+                // Starting the ramp down as we get close to the loop point
+                if (!playbackStopping)
+                {
+                    const double distanceToEnd = isReversed ? sampleCurrentPosition - playbackEndPosition
+                                                            : playbackEndPosition - sampleCurrentPosition;
+
+                    // (once we are less than a sample away this can't happen)
+                    if (distanceToEnd >= absIncrement)
+                        numThisRun = samplesUntilCrossing(distanceToEnd - rampLength * absIncrement,
+                                                          absIncrement, numThisRun);
+                    else if (distanceToEnd < 0.0)
+                        numThisRun = 1;
+                }
+            }
+
+            // Starting the ramp down before the next noteOn
+            if (!playbackStopping && isFollowedByNoteOn)
+                numThisRun = jmin(numThisRun, jmax(0, numSamples - rampLength) + 1);
+
+            if (!readDirectly)
+            {
+                // only render as much as fits in the window
+                const double windowFrames = streamWindowSize - 2 * streamWindowMargin;
+                const int maxRunLength = (int) (windowFrames / jmax(1.0, fabs(playIncrement)));
+                numThisRun = jmin(numThisRun, jmax(1, maxRunLength));
+            }
 
-            l *= stripVolume;
-            r *= stripVolume;
+            jassert(numThisRun > 0);
+
+
+            if (readDirectly)
+            {
+                RenderKernels::addRun(interpolationMode, inL, inR, inLength, outL, outR, numThisRun,
+                                      sampleCurrentPosition, playIncrement,
+                                      stripVolume, envStart, envIncrement);
+            }
+            else
+            {
+                // read the part of the sample this run covers...
+                const double endPosition = sampleCurrentPosition + (numThisRun - 1) * playIncrement;
+                const int windowStart = jlimit(0, inLength - 1,
+                    (int) floor(jmin(sampleCurrentPosition, endPosition)) - streamWindowMargin);
+                const int windowEnd = jlimit(windowStart + 1, inLength,
+                    (int) floor(jmax(sampleCurrentPosition, endPosition)) + streamWindowMargin + 1);
+                const int windowLength = jmin(windowEnd - windowStart, (int) streamWindowSize);
+
+                currentSample->readFrames(streamWindow.getSampleData(0, 0),
+                                          isStereo ? streamWindow.getSampleData(1, 0) : nullptr,
+                                          windowStart, windowLength);
+
+                // ...and render it as if the window were the whole sample
+                RenderKernels::addRun(interpolationMode, inL, inR, windowLength, outL, outR, numThisRun,
+                                      sampleCurrentPosition - windowStart, playIncrement,
+                                      stripVolume, envStart, envIncrement);
+            }
+
+            outL += numThisRun;
+            if (outR != nullptr) outR += numThisRun;
+            numSamples -= numThisRun;
+
+            // where we were for the last sample of the run
+            const double lastPosition = sampleCurrentPosition + (numThisRun - 1) * playIncrement;
+
+
+            // Now apply the per-sample logic for the last sample of this run
 
             // if we are starting playback, put a short
             // envelope on it to avoid pops / clicks
             if (playbackStarting)
             {
-                startVol += startVolInc;
+                startVol += numThisRun * startVolInc;
                 if (startVol > 1.0f)
                 {
                     startVol = 1.0f;
                     playbackStarting = false;
                 }
-
-                l *= startVol;
-                r *= startVol;
             }
 
             // if we are stopping playback, put a short
             // envelope on it to avoid pops / clicks
             if (playbackStopping)
             {
-                switch (stopMode)
-                {
-                // normal stop (linear volume ramp)
-                case mStopNormal :
-                case mStopEnvelope :
-                    {
-                        stopVol -= stopVolDec;
-
-                        l *= stopVol;
-                        r *= stopVol;
-                        break;
-                    }
-                // simulate a tape stopping
-                case mStopTape :
-                    {
-                        // linear speed decrease
-                        tapeStopSpeed -= 0.0001f;
-                        // with a volume ramp at the end
-                        if (tapeStopSpeed < 0.25f)
-                        {
-                            stopVol = 4.0f * tapeStopSpeed;
-                            l *= stopVol;
-                            r *= stopVol;
-                        }
-                        break;
-                    }
-                // stop without any volume ramp (bad idea generally
-                // as you get pops and clicks)
-                case mStopInstant :
-                    {
-                        const bool newPlayStatus = false;
-                        setSampleStripParam(pIsPlaying, &newPlayStatus);
-                        break;
-                    }
-                default : jassertfalse;
-                }
-
+                if (!isTapeStopping)
+                    stopVol -= numThisRun * stopVolDec;
 
                 // once the volume / playspeed ramps get
                 // small enough, stop the playing completely
@@ -704,24 +992,10 @@ void SampleStrip::renderNextSection(AudioSampleBuffer& outputBuffer, int startSa
                 }
             }
 
-            // if we have stereo output avaiable
-            if (outR != nullptr)
-            {
-                *outL++ += l;
-                *outR++ += r;
-            }
-            else
-            {
-                // else average the two channels
-                *outL++ += (l + r) * 0.5f;
-            }
-
 
-            // this is how much the playback position (in/de)creases for each output sample
-            const double playIncrement = playSpeed * tapeStopSpeed;
             // how many audio samples in our playback buffer until we loop or finish playback
-            int playbackSamplesLeftToEnd = (int) (abs( (sampleCurrentPosition - playbackEndPosition) / playIncrement));
-
+            const int playbackSamplesLeftToEnd = (playIncrement != 0.0)
+                ? (int) (abs( (lastPosition - playbackEndPosition) / playIncrement)) : 0;
 
             // if we are only rendering as far as the next noteOn, then start to
             // ramp down as we near the end of the current batch to avoid clicks
@@ -744,11 +1018,11 @@ void SampleStrip::renderNextSection(AudioSampleBuffer& outputBuffer, int startSa
                 beginVolRampDown(playbackSamplesLeftToEnd);
             }
 
+            sampleCurrentPosition = lastPosition + playIncrement;
+
             // normal playback
             if (!isReversed)
             {
-                sampleCurrentPosition += playIncrement;
-
                 switch (currentPlayMode)
                 {
 
@@ -783,8 +1057,6 @@ void SampleStrip::renderNextSection(AudioSampleBuffer& outputBuffer, int startSa
             else
             {
                 // go back in time...
-                sampleCurrentPosition += playIncrement;
-
                 switch (currentPlayMode)
                 {
 
@@ -820,6 +1092,17 @@ void SampleStrip::renderNextSection(AudioSampleBuffer& outputBuffer, int startSa
     }
 }
 
+int SampleStrip::samplesUntilCrossing(const double &distance, const double &increment, const int &maxSamples)
+{
+    // Moving by increment each sample, the first sample (counting from 1)
+    // that takes us past distance. If we're already past, that's the first.
+    if (distance < 0.0)
+        return 1;
+
+    const double n = std::floor(distance / increment) + 1.0;
+    return (n < (double) maxSamples) ? (int) n : maxSamples;
+}
+
 void SampleStrip::beginVolRampUp(const int &length)
 {
     // clear any stopping ramps
@@ -870,6 +1153,14 @@ void SampleStrip::startSamplePlaying(const int &chunk)
 
 void SampleStrip::stopSamplePlaying(const int &newStopMode)
 {
+    if (!canApplyChangeNow())
+    {
+        PendingChange change(cStopPlaying);
+        change.intValue = newStopMode;
+        queueChange(change);
+        return;
+    }
+
     stopMode = newStopMode;
 
     // start ramping down (normal length)
@@ -15,12 +15,14 @@
 #define __SAMPLESTRIP_H_ACB589A6__
 
 #include "AudioSample.h"
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "StripEventRouter.h"
+#include "JuceHeader.h"
 
-// forward declaration
+// forward declarations
 class mlrVSTAudioProcessor;
+template <int parameterID> struct SampleStripParamInfo;
 
-class SampleStrip : public ChangeBroadcaster
+class SampleStrip
 {
 public:
     SampleStrip(const int &newID, mlrVSTAudioProcessor *owner);
@@ -55,6 +57,7 @@ public:
         pIsPlaySpeedInc, pIsPlaySpeedDec,
         pFractionalStart, pFractionalEnd,
         pRampLength,
+        pInterpolation,     // see RenderKernels::InterpolationMode
         pStripID,
         TotalNumParams
     };
@@ -87,12 +90,35 @@ public:
         mStopInstant
     };
 
+    /* Lets the GUI know that a parameter has changed (it picks this up
+       from the next GUIStateSnapshot). This doesn't lock or allocate, so
+       is fine from the audio thread.
+    */
+    void markChanged() { ++changeCount; }
+    uint32 getChangeCount() const { return changeCount.get(); }
+
     // these are for getting / setting the parameters
     void setSampleStripParam(const int &parameterID, const void *newValue,
                              const bool &sendChangeMsg = true);
     const void* getSampleStripParam(const int &parameterID) const;
     void toggleSampleStripParam(const int &parameterID, const bool &sendChangeMsg = true);
 
+    // Typed versions of the above for when the parameter is known at compile
+    // time, e.g. getSampleStripParam<pCurrentChannel>() returns the int itself
+    // so reading it is just a load (no switch or casting). Setting still goes
+    // through the switch so the side effects and queueing are the same.
+    template <int parameterID>
+    const typename SampleStripParamInfo<parameterID>::Type& getSampleStripParam() const
+    {
+        return this->*SampleStripParamInfo<parameterID>::member();
+    }
+    template <int parameterID>
+    void setSampleStripParam(const typename SampleStripParamInfo<parameterID>::Type &newValue,
+                             const bool &sendChangeMsg = true)
+    {
+        setSampleStripParam(parameterID, SampleStripParamInfo<parameterID>::toVoid(newValue), sendChangeMsg);
+    }
+
 	void cycleChannels();
 
     double findInitialPlaySpeed(const double &BPM, const float &hostSampleRate, const bool &applyChange = true);
@@ -104,8 +130,13 @@ public:
     void modPlaySpeed(const double &factor);
     void updateCurrentPlaybackPercentage();
 
-    void handleMidiEvent(const MidiMessage& m);
-    void renderNextBlock(AudioSampleBuffer& outputBuffer, const MidiBuffer& midiData,
+    // Changes made from outside the audio thread (GUI, OSC, timer) are
+    // queued and applied by the audio thread at the start of each block.
+    void applyPendingChanges();
+
+    // state is true for a button press, false for a button lift
+    void handleNoteEvent(const int &monomeCol, const bool &state);
+    void renderNextBlock(AudioSampleBuffer& outputBuffer, const StripEventRouter &events,
                          int startSample, int numSamples);
     void renderNextSection(AudioSampleBuffer& outputBuffer, int startSample,
                            int numSamples, const bool &isFollowedByNoteOn);
@@ -162,6 +193,7 @@ public:
         case pStartChunk : return "sample_chunk_start";
         case pEndChunk : return "sample_chunk_end";
         case pRampLength : return "ramp_length";
+        case pInterpolation : return "interpolation";
 
         case pIsVolInc : return "is_vol_inc";
         case pIsVolDec : return "is_vol_dec";
@@ -200,6 +232,12 @@ public:
         case pFractionalStart : return TypeFloat;
         case pFractionalEnd : return TypeFloat;
         case pStripID : return TypeInt;
+        case pIsVolInc : return TypeBool;
+        case pIsVolDec : return TypeBool;
+        case pIsPlaySpeedInc : return TypeBool;
+        case pIsPlaySpeedDec : return TypeBool;
+        case pRampLength : return TypeInt;
+        case pInterpolation : return TypeInt;
         default : jassertfalse; return TypeError;
         }
     }
@@ -243,6 +281,7 @@ public:
         case pFractionalStart : return true;
         case pFractionalEnd : return true;
         case pRampLength : return false;
+        case pInterpolation : return true;
         default : jassertfalse; return false;
         }
     }
@@ -264,6 +303,7 @@ private:
 
     // communication //////////////////////////
     mlrVSTAudioProcessor * const parent;        // with audio processor
+    Atomic<uint32> changeCount;                 // see markChanged()
 
     // playback parameters /////////////////////
     int currentChannel;                     // what channel is selected
@@ -310,6 +350,15 @@ private:
     double previousBPM;
 
 
+    // which RenderKernels interpolation to use
+    int interpolationMode;
+
+    // Samples that aren't in memory are read a window at a time into
+    // here, with a margin either side for the interpolation to use.
+    enum { streamWindowSize = 8192, streamWindowMargin = 64 };
+    AudioSampleBuffer streamWindow;
+
+
     // starting & stopping ////////////////////////////////////////////
     int rampLength;         // length of the ramp in samples
 
@@ -325,6 +374,10 @@ private:
     float tapeStopSpeed;    // the speed during the ramp (for tape mode)
     void beginVolRampDown(const int &length);
 
+    // number of samples (at most maxSamples) until moving by
+    // increment per sample takes us past distance
+    static int samplesUntilCrossing(const double &distance, const double &increment, const int &maxSamples);
+
 
     // misc /////////////////////////////////////////////////
     // Boolean grid which stores the status of button presses
@@ -336,11 +389,115 @@ private:
     void updateForNewSample();
 
 
-    // This is used to control access to the rendering
-    // callback and the note trigger methods.
-    CriticalSection lock;
+    // thread handoff ///////////////////////////////////////////////
+    // Other threads never touch the playback state directly, instead
+    // they push changes onto this queue for the audio thread to apply.
+    enum PendingChangeType
+    {
+        cSetParam,
+        cToggleParam,
+        cModPlaySpeed,
+        cStopPlaying,
+        cBPMChange,
+        cSelectionChange,
+        cInitialPlaySpeed
+    };
+
+    struct PendingChange
+    {
+        PendingChange(const int &changeType = cSetParam)
+            : type(changeType), parameterID(-1), sendChangeMsg(true),
+              intValue(0), floatValue(0.0f), doubleValue(0.0), boolValue(false),
+              sampleValue(nullptr)
+        {}
+
+        int type, parameterID;
+        bool sendChangeMsg;
+
+        // the new value (see getParameterType) or arguments
+        int intValue;
+        float floatValue;
+        double doubleValue;
+        bool boolValue;
+        const AudioSample *sampleValue;
+    };
+
+    static const int pendingChangeQueueSize = 256;
+    // how long (in ms) to wait for the audio thread if the queue is full
+    static const int maxQueueFullWait = 50;
+    AbstractFifo pendingChangeFifo;
+    PendingChange pendingChanges[pendingChangeQueueSize];
+
+    // The audio thread never takes this lock, it only stops
+    // the GUI and OSC threads from writing at the same time.
+    CriticalSection producerLock;
+
+    bool canApplyChangeNow() const;
+    void queueChange(const PendingChange &change);
+    void applyChange(const PendingChange &change);
+
+    // allows the typed getters to find the members
+    template <int parameterID> friend struct SampleStripParamInfo;
 
     JUCE_LEAK_DETECTOR(SampleStrip);
 };
 
+
+// Typed parameter lookup ////////////////////////////////////////////////
+// Each parameter is mapped to the member which stores it, along with its
+// type. The names / types used for presets are still in the switches above.
+#define MLR_SAMPLESTRIP_PARAM(parameterID, ParamType, memberName) \
+    template <> struct SampleStripParamInfo<SampleStrip::parameterID> \
+    { \
+        typedef ParamType Type; \
+        typedef ParamType SampleStrip::* MemberPtr; \
+        static MemberPtr member() { return &SampleStrip::memberName; } \
+        static const void* toVoid(const Type &newValue) { return &newValue; } \
+    };
+
+MLR_SAMPLESTRIP_PARAM (pCurrentChannel,      int,    currentChannel)
+MLR_SAMPLESTRIP_PARAM (pIsPlaying,           bool,   isPlaying)
+MLR_SAMPLESTRIP_PARAM (pPlaybackPercentage,  float,  playbackPercentage)
+MLR_SAMPLESTRIP_PARAM (pNumChunks,           int,    numChunks)
+MLR_SAMPLESTRIP_PARAM (pPlayMode,            int,    currentPlayMode)
+MLR_SAMPLESTRIP_PARAM (pIsLatched,           bool,   isLatched)
+MLR_SAMPLESTRIP_PARAM (pIsReversed,          bool,   isReversed)
+MLR_SAMPLESTRIP_PARAM (pStripVolume,         float,  stripVolume)
+MLR_SAMPLESTRIP_PARAM (pPlaySpeed,           double, playSpeed)
+MLR_SAMPLESTRIP_PARAM (pIsPlaySpeedLocked,   bool,   isPlaySpeedLocked)
+MLR_SAMPLESTRIP_PARAM (pVisualStart,         int,    visualSelectionStart)
+MLR_SAMPLESTRIP_PARAM (pVisualEnd,           int,    visualSelectionEnd)
+MLR_SAMPLESTRIP_PARAM (pChunkSize,           int,    chunkSize)
+MLR_SAMPLESTRIP_PARAM (pSampleStart,         int,    selectionStart)
+MLR_SAMPLESTRIP_PARAM (pSampleEnd,           int,    selectionEnd)
+MLR_SAMPLESTRIP_PARAM (pStartChunk,          int,    loopStartChunk)
+MLR_SAMPLESTRIP_PARAM (pEndChunk,            int,    loopEndChunk)
+MLR_SAMPLESTRIP_PARAM (pIsVolInc,            bool,   volumeIncreasing)
+MLR_SAMPLESTRIP_PARAM (pIsVolDec,            bool,   volumeDecreasing)
+MLR_SAMPLESTRIP_PARAM (pIsPlaySpeedInc,      bool,   playSpeedIncreasing)
+MLR_SAMPLESTRIP_PARAM (pIsPlaySpeedDec,      bool,   playSpeedDecreasing)
+MLR_SAMPLESTRIP_PARAM (pFractionalStart,     float,  fractionalSampleStart)
+MLR_SAMPLESTRIP_PARAM (pFractionalEnd,       float,  fractionalSampleEnd)
+MLR_SAMPLESTRIP_PARAM (pRampLength,          int,    rampLength)
+MLR_SAMPLESTRIP_PARAM (pInterpolation,       int,    interpolationMode)
+
+#undef MLR_SAMPLESTRIP_PARAM
+
+// the void* version passes the AudioSample itself, not a pointer to it
+template <> struct SampleStripParamInfo<SampleStrip::pAudioSample>
+{
+    typedef const AudioSample* Type;
+    typedef const AudioSample* SampleStrip::* MemberPtr;
+    static MemberPtr member() { return &SampleStrip::currentSample; }
+    static const void* toVoid(const Type &newValue) { return newValue; }
+};
+
+// the ID is fixed, so this can only be read
+template <> struct SampleStripParamInfo<SampleStrip::pStripID>
+{
+    typedef const int Type;
+    typedef const int SampleStrip::* MemberPtr;
+    static MemberPtr member() { return &SampleStrip::sampleStripID; }
+};
+
 #endif  // __SAMPLESTRIP_H_ACB589A6__
\ No newline at end of file
@@ -11,6 +11,7 @@ Custom component to display a waveform (corresponding to an mlr row)
 */
 
 #include "mlrVSTGUI.h"
+#include "RenderKernels.h"
 #include <cstdlib>
 #include <cmath>
 
@@ -21,7 +22,8 @@ SampleStripControl::SampleStripControl(const int &id, const int &width, const in
 
     // ID / communication //////////////////////////
     processor(owner), sampleStripID(id),
-    dataStrip(dataStripLink), stripChanged(true),
+    dataStrip(dataStripLink), stripChanged(true), lastChangeCount(dataStripLink->getChangeCount()),
+    droppedFileLoading(),
 
     // GUI dimensions //////////////////////////////
     componentHeight(height), componentWidth(width), controlbarSize(18),
@@ -77,7 +79,7 @@ SampleStripControl::SampleStripControl(const int &id, const int &width, const in
     addAndMakeVisible(popupLocators.getLast());
     popupLocators.getLast()->setBounds(3 * componentWidth / 4, controlbarSize, 1, 1);
 
-    dataStrip->addChangeListener(this);
+    processor->addSampleLoaderListener(this);
 
     // listen for user input
     stripVolumeSldr.addChangeListener(this);
@@ -94,7 +96,7 @@ SampleStripControl::SampleStripControl(const int &id, const int &width, const in
 
 SampleStripControl::~SampleStripControl()
 {
-    dataStrip->removeChangeListener(this);
+    processor->removeSampleLoaderListener(this);
     channelButtonArray.clear(true);
     popupLocators.clear(true);
 }
@@ -102,16 +104,8 @@ SampleStripControl::~SampleStripControl()
 
 void SampleStripControl::changeListenerCallback(ChangeBroadcaster * sender)
 {
-    /* TODO: this gets called A LOT during playback (as playback percentage
-    is considered a parameter). Maybe seperate that out from the param setup?
-    */
-    if (sender == dataStrip)
-    {
-        stripChanged = true;
-
-
-    }
-    else if (sender == &stripVolumeSldr)
+    // (changes to the strip itself come through updateFromState)
+    if (sender == &stripVolumeSldr)
     {
         float newStripVol = stripVolumeSldr.getValue();
         thumbnailScaleFactor = newStripVol;
@@ -442,8 +436,29 @@ void SampleStripControl::mouseUp(const MouseEvent& e)
                     DBG("option none selected");
                 }
 
+                // the playback quality can also be picked from here, these
+                // items are offset so they don't clash with the samples
+                const int interpolationMenuOffset = 10000;
+                const int currentInterpolation = dataStrip->getSampleStripParam<SampleStrip::pInterpolation>();
+                PopupMenu interpolationMenu = PopupMenu();
+
+                for (int m = 0; m < RenderKernels::NumInterpolationModes; ++m)
+                    interpolationMenu.addItem(interpolationMenuOffset + m, RenderKernels::getInterpolationName(m),
+                                              true, m == currentInterpolation);
+
+                sampleMenu.addSeparator();
+                sampleMenu.addSubMenu("interpolation", interpolationMenu);
+
                 // show the menu and store choice
                 int fileChoice = sampleMenu.showMenu(PopupMenu::Options().withTargetComponent(popupLocators[selectedHitZone]));
+
+                if (fileChoice >= interpolationMenuOffset)
+                {
+                    const int newInterpolation = fileChoice - interpolationMenuOffset;
+                    dataStrip->setSampleStripParam<SampleStrip::pInterpolation>(newInterpolation);
+                    break;
+                }
+
                 // subtract 1 from loop above
                 fileChoice -= 1;
 
@@ -683,13 +698,11 @@ void SampleStripControl::paint(Graphics& g)
 
 void SampleStripControl::filesDropped(const StringArray& files, int /*x*/, int /*y*/)
 {
-    // assume that all files fail (pessimistic I know)
-    int fileIndex = -1;
-
     // don't add files recursively
     const bool useRecursive = false;
 
-    // try to add each of the loaded files to the sample pool
+    // Queue each of the files to be loaded into the sample pool. The loading
+    // happens in the background and the last file to load is selected.
     for (int i = 0; i < files.size(); ++i)
     {
         File currentSampleFile(files[i]);
@@ -706,32 +719,47 @@ void SampleStripControl::filesDropped(const StringArray& files, int /*x*/, int /
                 File childFile = di.getFile();
                 DBG("Dragged file (in directory): " << childFile.getFileName());
 
-                // and if so try to load the file
-                const int newFileIndex = processor->addNewSample( childFile );
-
-                // if we have a sucessful load, we can set this as the
-                // SampleStrip's new sample
-                if (newFileIndex != -1) fileIndex = newFileIndex;
+                if (processor->loadSampleAsync(childFile, sampleStripID))
+                    droppedFileLoading = childFile;
             }
         }
         else
         {
             DBG("Dragged file: " << files[i]);
 
-            // try to load the file
-            const int newFileIndex = processor->addNewSample(currentSampleFile);
-
-            // if we have a sucessful load, we can set this as the
-            // SampleStrip's new sample
-            if (newFileIndex != -1) fileIndex = newFileIndex;
+            if (processor->loadSampleAsync(currentSampleFile, sampleStripID))
+                droppedFileLoading = currentSampleFile;
         }
     }
+}
+
+void SampleStripControl::sampleLoadProgress(const File &sampleFile, const float &progress)
+{
+    if (sampleFile == droppedFileLoading)
+    {
+        filenameLbl.setText("loading " + sampleFile.getFileName()
+                            + " (" + String(roundToInt(progress * 100.0f)) + "%)",
+                            NotificationType::dontSendNotification);
+    }
+}
+
+void SampleStripControl::sampleLoadFinished(const File &sampleFile, const int &samplePoolIndex,
+                                            const int &targetStripID)
+{
+    // only interested in the last file dropped on this strip
+    if (sampleFile != droppedFileLoading || targetStripID != sampleStripID) return;
+
+    droppedFileLoading = File::nonexistent;
 
-    // if any of the the files loaded, select the last
-    // file to sucessfully load
-    if (fileIndex >= 0)
+    if (samplePoolIndex >= 0)
+    {
+        selectNewSample(samplePoolIndex, mlrVSTAudioProcessor::pSamplePool);
+    }
+    else
     {
-        selectNewSample(fileIndex, mlrVSTAudioProcessor::pSamplePool);
+        // put the label back to how it was
+        filenameLbl.setText((currentSample != nullptr) ? currentSample->getSampleName() : "No file",
+                            NotificationType::dontSendNotification);
     }
 }
 
@@ -13,12 +13,13 @@
 #ifndef __SAMPLESTRIPCONTROL_H_E96F19F8__
 #define __SAMPLESTRIPCONTROL_H_E96F19F8__
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 #include "AudioSample.h"
 #include "SampleStripControl.h"
 #include "mlrVSTLookAndFeel.h"
 #include "CustomArrowButton.h"
 #include "TextDragSlider.h"
+#include "GUIStateSnapshot.h"
 
 /* Forward declaration to set up pointer arrangement
    to allow sample strips to access the UI */
@@ -28,7 +29,8 @@ class SampleStripControl :  public Component,
     public ChangeListener,
     public ButtonListener,
     public ComboBoxListener,
-    public FileDragAndDropTarget
+    public FileDragAndDropTarget,
+    public SampleLoader::Listener
 {
 public:
     SampleStripControl(const int &id,
@@ -60,6 +62,11 @@ public:
     bool isInterestedInFileDrag(const StringArray&) { return true; }
     void filesDropped(const StringArray& files, int x, int y);
 
+    // dropped files are loaded in the background (see SampleLoader)
+    void sampleLoadProgress(const File &sampleFile, const float &progress);
+    void sampleLoadFinished(const File &sampleFile, const int &samplePoolIndex,
+                            const int &targetStripID);
+
     // Picks a new sample from the sample pool,
     // selects it all and finds the new playSpeed.
     void selectNewSample(const int &fileChoice, const int &poolID);
@@ -72,16 +79,25 @@ public:
         buildUI();  // reflect changes
     }
 
-    void updatePlaybackStatus()
+    // (GUI thread) catches up with the strip's state from the last snapshot
+    void updateFromState(const GUIStateSnapshot::StripState &state)
     {
-        // no need to update if nothing is happening
-        if (isPlaying)
+        // no need to redraw unless the playback position has moved
+        if (state.isPlaying != isPlaying || (isPlaying && state.playbackPercentage != playbackPercentage))
         {
-            playbackPercentage = *static_cast<const float*>(dataStrip->getSampleStripParam(SampleStrip::pPlaybackPercentage));
+            isPlaying = state.isPlaying;
+            playbackPercentage = state.playbackPercentage;
             repaint();
         }
 
-        isPlaying = *static_cast<const bool*>(dataStrip->getSampleStripParam(SampleStrip::pIsPlaying));
+        // any other change and we check all the params
+        if (state.changeCount != lastChangeCount)
+        {
+            lastChangeCount = state.changeCount;
+            stripChanged = true;
+        }
+
+        updateParamsIfChanged();
     }
 
     void updateParamsIfChanged()
@@ -112,6 +128,8 @@ private:
     const int sampleStripID;            // which strip we are representing
     SampleStrip * const dataStrip;      // pointer to data structure for samplestrip
     bool stripChanged;                  // do we need to redraw
+    uint32 lastChangeCount;             // the strip's change count when we last checked
+    File droppedFileLoading;            // last dropped file (while it loads)
 
     // GUI dimensions //////////////////////////////
     const int componentHeight, componentWidth;
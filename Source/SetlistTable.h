@@ -12,7 +12,7 @@
 #define __SETLISTTABLE_H_6F0B8E4A__
 
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 #include "PresetListTable.h"
 
 class mlrVSTAudioProcessor;
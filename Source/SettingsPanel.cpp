@@ -43,7 +43,19 @@ SettingsPanel::SettingsPanel(const Rectangle<int> &bounds,
     selMonomeSize(),
 
     setNumSampleStrips("num sample strips", "num sample strips"),
-    selNumSampleStrips()
+    selNumSampleStrips(),
+
+    setNumRenderThreadsLbl("render threads", "render threads"),
+    selNumRenderThreads(),
+
+    setSampleMemoryBudgetLbl("prefetch memory", "prefetch memory"),
+    selSampleMemoryBudget(),
+
+    setDiskRecordFormatLbl("record to", "record to"),
+    selDiskRecordFormat(),
+
+    setLEDFrameRateLbl("led frame rate", "led frame rate"),
+    selLEDFrameRate()
 {
     // main panel label
     addAndMakeVisible(&panelLabel);
@@ -170,6 +182,72 @@ SettingsPanel::SettingsPanel(const Rectangle<int> &bounds,
     selNumSampleStrips.setSelectedId(numSampleStrips+1, NotificationType::dontSendNotification);
     yPos += PAD_AMOUNT + labelHeight;
 
+
+    // how many threads to render the strips with
+    setupLabel(setNumRenderThreadsLbl);
+    setNumRenderThreadsLbl.setBounds(PAD_AMOUNT, yPos, labelWidth, labelHeight);
+    addAndMakeVisible(&selNumRenderThreads);
+    selNumRenderThreads.addListener(this);
+    selNumRenderThreads.addItem("audio thread only", 1);
+    for (int t = 2; t <= StripRenderPool::maxNumThreads; ++t)
+        selNumRenderThreads.addItem(String(t), t);
+    selNumRenderThreads.setBounds(labelWidth + 2 * PAD_AMOUNT, yPos, labelWidth, labelHeight);
+    const int numRenderThreads = *static_cast<const int*>
+        (processor->getGlobalSetting(GlobalSettings::sNumRenderThreads));
+    selNumRenderThreads.setSelectedId(numRenderThreads, NotificationType::dontSendNotification);
+    selNumRenderThreads.setLookAndFeel(&overLF);
+    yPos += PAD_AMOUNT + labelHeight;
+
+
+    // how much memory the setlist can use loading samples ahead of time
+    // (the item IDs are the budget in MB, apart from "none")
+    setupLabel(setSampleMemoryBudgetLbl);
+    setSampleMemoryBudgetLbl.setBounds(PAD_AMOUNT, yPos, labelWidth, labelHeight);
+    addAndMakeVisible(&selSampleMemoryBudget);
+    selSampleMemoryBudget.addListener(this);
+    selSampleMemoryBudget.addItem("none", 1);
+    for (int mb = 256; mb <= 2048; mb *= 2)
+        selSampleMemoryBudget.addItem(String(mb) + " MB", mb);
+    selSampleMemoryBudget.setBounds(labelWidth + 2 * PAD_AMOUNT, yPos, labelWidth, labelHeight);
+    const int sampleMemoryBudget = *static_cast<const int*>
+        (processor->getGlobalSetting(GlobalSettings::sSampleMemoryBudget));
+    selSampleMemoryBudget.setSelectedId(sampleMemoryBudget > 0 ? sampleMemoryBudget : 1,
+                                        NotificationType::dontSendNotification);
+    selSampleMemoryBudget.setLookAndFeel(&overLF);
+    yPos += PAD_AMOUNT + labelHeight;
+
+    // whether takes are kept in memory or written to disk
+    // (the item IDs are the DiskRecorder::FileFormat + 1)
+    setupLabel(setDiskRecordFormatLbl);
+    setDiskRecordFormatLbl.setBounds(PAD_AMOUNT, yPos, labelWidth, labelHeight);
+    addAndMakeVisible(&selDiskRecordFormat);
+    selDiskRecordFormat.addListener(this);
+    selDiskRecordFormat.addItem("memory", DiskRecorder::formatNone + 1);
+    selDiskRecordFormat.addItem("disk (wav)", DiskRecorder::formatWav + 1);
+    selDiskRecordFormat.addItem("disk (flac)", DiskRecorder::formatFlac + 1);
+    selDiskRecordFormat.setBounds(labelWidth + 2 * PAD_AMOUNT, yPos, labelWidth, labelHeight);
+    const int diskRecordFormat = *static_cast<const int*>
+        (processor->getGlobalSetting(GlobalSettings::sDiskRecordFormat));
+    selDiskRecordFormat.setSelectedId(diskRecordFormat + 1, NotificationType::dontSendNotification);
+    selDiskRecordFormat.setLookAndFeel(&overLF);
+    yPos += PAD_AMOUNT + labelHeight;
+
+    // how often the monome's LEDs are updated (the
+    // item IDs are the number of frames per second)
+    setupLabel(setLEDFrameRateLbl);
+    setLEDFrameRateLbl.setBounds(PAD_AMOUNT, yPos, labelWidth, labelHeight);
+    addAndMakeVisible(&selLEDFrameRate);
+    selLEDFrameRate.addListener(this);
+    selLEDFrameRate.addItem("15 fps", 15);
+    selLEDFrameRate.addItem("30 fps", 30);
+    selLEDFrameRate.addItem("60 fps", 60);
+    selLEDFrameRate.setBounds(labelWidth + 2 * PAD_AMOUNT, yPos, labelWidth, labelHeight);
+    const int ledFrameRate = *static_cast<const int*>
+        (processor->getGlobalSetting(GlobalSettings::sLEDFrameRate));
+    selLEDFrameRate.setSelectedId(ledFrameRate, NotificationType::dontSendNotification);
+    selLEDFrameRate.setLookAndFeel(&overLF);
+    yPos += PAD_AMOUNT + labelHeight;
+
 }
 
 void SettingsPanel::paint(Graphics &g)
@@ -221,6 +299,39 @@ void SettingsPanel::comboBoxChanged(ComboBox *box)
         // let the UI repaint, it will then update the global setting
         pluginUI->buildSampleStripControls(newNumSampleStrips);
     }
+    else if (box == &selNumRenderThreads)
+    {
+        const int newNumRenderThreads = box->getSelectedId();
+        DBG("New num render threads: " + String(newNumRenderThreads));
+
+        // update the global setting
+        pluginUI->setGlobalSetting(GlobalSettings::sNumRenderThreads, &newNumRenderThreads);
+    }
+    else if (box == &selSampleMemoryBudget)
+    {
+        const int selectedId = box->getSelectedId();
+        const int newSampleMemoryBudget = (selectedId > 1) ? selectedId : 0;
+        DBG("New sample memory budget: " << newSampleMemoryBudget << "MB");
+
+        // update the global setting
+        pluginUI->setGlobalSetting(GlobalSettings::sSampleMemoryBudget, &newSampleMemoryBudget);
+    }
+    else if (box == &selDiskRecordFormat)
+    {
+        const int newDiskRecordFormat = box->getSelectedId() - 1;
+        DBG("New disk record format: " << newDiskRecordFormat);
+
+        // update the global setting
+        pluginUI->setGlobalSetting(GlobalSettings::sDiskRecordFormat, &newDiskRecordFormat);
+    }
+    else if (box == &selLEDFrameRate)
+    {
+        const int newLEDFrameRate = box->getSelectedId();
+        DBG("New LED frame rate: " << newLEDFrameRate);
+
+        // update the global setting
+        pluginUI->setGlobalSetting(GlobalSettings::sLEDFrameRate, &newLEDFrameRate);
+    }
 }
 
 void SettingsPanel::textEditorChanged(TextEditor &editor)
@@ -11,7 +11,7 @@ Author:  Hemmer
 #ifndef __SETTINGSPANEL_H_726D4579__
 #define __SETTINGSPANEL_H_726D4579__
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 #include "mlrVSTLookAndFeel.h"
 
 /* Forward declaration to set up pointer arrangement
@@ -82,6 +82,18 @@ private:
     Label setNumSampleStrips;
     ComboBox selNumSampleStrips;
 
+    Label setNumRenderThreadsLbl;
+    ComboBox selNumRenderThreads;
+
+    Label setSampleMemoryBudgetLbl;
+    ComboBox selSampleMemoryBudget;
+
+    Label setDiskRecordFormatLbl;
+    ComboBox selDiskRecordFormat;
+
+    Label setLEDFrameRateLbl;
+    ComboBox selLEDFrameRate;
+
     void setupLabel(Label &lbl)
     {
         addAndMakeVisible(&lbl);
@@ -0,0 +1,129 @@
+/*
+  ==============================================================================
+
+    StripEventRouter.cpp
+    Created: 18 Oct 2026 5:21:33pm
+    Author:  hemmer
+
+  ==============================================================================
+*/
+
+#include "StripEventRouter.h"
+#include "SampleStrip.h"
+
+StripEventRouter::StripEventRouter() :
+    stripEvents(), channelEvents(), stripChannels(),
+    reservedEventsPerList(64), nextOrder(0), numDroppedEvents(0), noEvents()
+{
+}
+
+void StripEventRouter::prepare(const int &maxNumStrips, const int &maxNumChannels, const int &eventsPerBlock)
+{
+    reservedEventsPerList = jmax(reservedEventsPerList, eventsPerBlock);
+
+    ensureSize(stripEvents, maxNumStrips);
+    ensureSize(channelEvents, maxNumChannels);
+    stripChannels.ensureStorageAllocated(maxNumStrips);
+
+    for (int s = 0; s < stripEvents.size(); ++s)
+        stripEvents.getUnchecked(s)->ensureStorageAllocated(reservedEventsPerList);
+    for (int c = 0; c < channelEvents.size(); ++c)
+        channelEvents.getUnchecked(c)->ensureStorageAllocated(reservedEventsPerList);
+}
+
+void StripEventRouter::routeEvents(const MidiBuffer &midiMessages, const Array<Event> &patternEvents,
+                                   const OwnedArray<SampleStrip> &strips)
+{
+    const int numStrips = strips.size();
+
+    // only allocates if the number of strips has grown
+    ensureSize(stripEvents, numStrips);
+
+    // find the channels up front, rather than for every note
+    stripChannels.clearQuick();
+    for (int s = 0; s < numStrips; ++s)
+        stripChannels.add(strips.getUnchecked(s)->getSampleStripParam<SampleStrip::pCurrentChannel>());
+
+    for (int s = 0; s < stripEvents.size(); ++s)
+        stripEvents.getUnchecked(s)->clearQuick();
+    for (int c = 0; c < channelEvents.size(); ++c)
+        channelEvents.getUnchecked(c)->clearQuick();
+
+    nextOrder = 0;
+
+    MidiBuffer::Iterator midiIterator(midiMessages);
+    MidiMessage m(0xf4, 0.0);
+    int midiEventPos, p = 0;
+
+    while (midiIterator.getNextEvent(m, midiEventPos))
+    {
+        // we are only interested in note on/off messages,
+        // as other types of message may crash the VST
+        if (!m.isNoteOnOrOff()) continue;
+
+        // the pattern notes go after any MIDI at the same time
+        while (p < patternEvents.size() && patternEvents.getReference(p).position < midiEventPos)
+            addEvent(patternEvents.getReference(p++), numStrips);
+
+        // the MIDI channel tells us which strip this is for
+        Event e;
+        e.position = midiEventPos;
+        e.stripID = m.getChannel() - 1;
+        e.column = m.getNoteNumber();
+        e.isNoteOn = m.isNoteOn();
+
+        addEvent(e, numStrips);
+    }
+
+    while (p < patternEvents.size())
+        addEvent(patternEvents.getReference(p++), numStrips);
+}
+
+void StripEventRouter::addEvent(Event e, const int &numStrips)
+{
+    if (e.stripID < 0 || e.stripID >= numStrips) return;
+
+    e.order = nextOrder++;
+    addToList(*stripEvents.getUnchecked(e.stripID), e);
+
+    const int channel = stripChannels.getUnchecked(e.stripID);
+    if (channel >= 0 && channel < channelEvents.size())
+        addToList(*channelEvents.getUnchecked(channel), e);
+}
+
+void StripEventRouter::addToList(Array<Event> &list, const Event &e)
+{
+    // never let the list reallocate on the audio thread
+    if (list.size() >= reservedEventsPerList)
+    {
+        ++numDroppedEvents;
+        return;
+    }
+
+    list.add(e);
+}
+
+const Array<StripEventRouter::Event>& StripEventRouter::getStripEvents(const int &stripID) const
+{
+    if (stripID >= 0 && stripID < stripEvents.size())
+        return *stripEvents.getUnchecked(stripID);
+
+    return noEvents;
+}
+
+const Array<StripEventRouter::Event>& StripEventRouter::getChannelEvents(const int &channel) const
+{
+    if (channel >= 0 && channel < channelEvents.size())
+        return *channelEvents.getUnchecked(channel);
+
+    return noEvents;
+}
+
+void StripEventRouter::ensureSize(OwnedArray<Array<Event> > &lists, const int &numLists)
+{
+    while (lists.size() < numLists)
+    {
+        Array<Event> *newList = lists.add(new Array<Event>());
+        newList->ensureStorageAllocated(reservedEventsPerList);
+    }
+}
@@ -0,0 +1,78 @@
+/*
+  ==============================================================================
+
+    StripEventRouter.h
+    Created: 18 Oct 2026 5:21:33pm
+    Author:  hemmer
+
+    Monome presses reach the strips as MIDI (channel is the row, note number
+    is the column). Rather than every strip scanning the whole MidiBuffer,
+    the processor routes the block's MIDI once, giving each strip a list of
+    its own notes. Notes are also listed by the channel their strip is on,
+    so strips sharing that channel know when to stop (be "choked").
+
+  ==============================================================================
+*/
+
+#ifndef STRIPEVENTROUTER_H_INCLUDED
+#define STRIPEVENTROUTER_H_INCLUDED
+
+#include "JuceHeader.h"
+
+// forward declaration
+class SampleStrip;
+
+class StripEventRouter
+{
+public:
+    StripEventRouter();
+
+    struct Event
+    {
+        int position;       // sample position within the block
+        int order;          // order in the original MidiBuffer (to break ties)
+        int stripID;        // which strip the note is for
+        int column;         // monome column (MIDI note number)
+        bool isNoteOn;
+    };
+
+    // Allocate space ahead of time. No list grows past eventsPerBlock on
+    // the audio thread, any more notes than that are dropped (and counted).
+    void prepare(const int &maxNumStrips, const int &maxNumChannels, const int &eventsPerBlock);
+
+    // Makes a single pass over this block's MIDI, merged with the (sorted)
+    // notes from the patterns, sorting the notes by strip and by channel.
+    // This must be called after any channel changes are applied and before
+    // the strips are rendered.
+    void routeEvents(const MidiBuffer &midiMessages, const Array<Event> &patternEvents,
+                     const OwnedArray<SampleStrip> &strips);
+
+    // notes for this strip (in order)
+    const Array<Event>& getStripEvents(const int &stripID) const;
+    // notes for every strip on this channel (in order)
+    const Array<Event>& getChannelEvents(const int &channel) const;
+
+    // notes which didn't fit in their list since this was last reset
+    int getNumDroppedEvents() const { return numDroppedEvents.get(); }
+    void resetNumDroppedEvents() { numDroppedEvents = 0; }
+
+private:
+
+    void addEvent(Event e, const int &numStrips);
+    void addToList(Array<Event> &list, const Event &e);
+    void ensureSize(OwnedArray<Array<Event> > &lists, const int &numLists);
+
+    OwnedArray<Array<Event> > stripEvents, channelEvents;
+    Array<int> stripChannels;   // which channel each strip is on (this block)
+    int reservedEventsPerList;
+    int nextOrder;              // (for Event::order)
+    Atomic<int> numDroppedEvents;
+
+    // returned for strips / channels we don't know about
+    const Array<Event> noEvents;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StripEventRouter);
+};
+
+
+#endif  // STRIPEVENTROUTER_H_INCLUDED
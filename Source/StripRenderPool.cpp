@@ -0,0 +1,228 @@
+/*
+  ==============================================================================
+
+    StripRenderPool.cpp
+    Created: 18 Oct 2026 2:47:10pm
+    Author:  hemmer
+
+  ==============================================================================
+*/
+
+#include "StripRenderPool.h"
+#include "PluginProcessor.h"
+
+#if JUCE_MAC
+ #include <mach/mach.h>
+ #include <mach/thread_policy.h>
+#endif
+
+namespace
+{
+    // Makes the calling thread a real-time thread which runs every
+    // periodMs, like the audio thread (on Windows / Linux the highest
+    // priority already is, see Thread::setThreadPriority).
+    void setCurrentThreadToRealtime(const int &periodMs)
+    {
+       #if JUCE_MAC
+        // (these are in absolute time units, which are ns here)
+        thread_time_constraint_policy_data_t policy;
+        policy.period = (uint32_t) (periodMs * 1000000);
+        policy.computation = jmin((uint32_t) 5000000, policy.period / 2);
+        policy.constraint = policy.period;
+        policy.preemptible = true;
+
+        thread_policy_set(pthread_mach_thread_np(pthread_self()), THREAD_TIME_CONSTRAINT_POLICY,
+                          (thread_policy_t) &policy, THREAD_TIME_CONSTRAINT_POLICY_COUNT);
+       #else
+        (void) periodMs;
+        Thread::setCurrentThreadPriority(10);
+       #endif
+    }
+}
+
+StripRenderPool::StripRenderPool(mlrVSTAudioProcessor * const owner) :
+    processor(owner),
+    numThreads(1), bufferSize(0),
+    workers(), scratchBuffers(), mixBuffers(),
+    blockPeriodMs(10),
+    currentEvents(nullptr), currentNumStrips(0), currentNumSamples(0)
+{
+    resizeBuffers(0);
+}
+
+StripRenderPool::~StripRenderPool()
+{
+    stopWorkers();
+}
+
+void StripRenderPool::setNumThreads(const int &newNumThreads)
+{
+    const int newNum = jlimit(1, (int) maxNumThreads, newNumThreads);
+    if (newNum == numThreads) return;
+
+    // make sure we're not rendering while the workers change
+    processor->suspendProcessing(true);
+
+    stopWorkers();
+    numThreads = newNum;
+
+    // the audio thread renders the first share itself
+    for (int t = 1; t < numThreads; ++t)
+    {
+        Worker *worker = workers.add(new Worker(*this, t));
+        worker->startThread(10);
+        workerThreadIds[t] = worker->getThreadId();
+    }
+
+    resizeBuffers(bufferSize);
+
+    DBG("Rendering SampleStrips with " << numThreads << " thread(s)");
+
+    // resume processing
+    processor->suspendProcessing(false);
+}
+
+void StripRenderPool::prepareToPlay(const int &samplesPerBlock, const double &sampleRate)
+{
+    // this is not a completely accurate size as the block size may change with
+    // time, but at least we can allocate roughly the right size:
+    resizeBuffers(samplesPerBlock);
+
+    if (sampleRate > 0.0)
+        blockPeriodMs = jmax(1, roundToInt(1000.0 * samplesPerBlock / sampleRate));
+}
+
+bool StripRenderPool::isWorkerThread() const
+{
+    const Thread::ThreadID thisThread = Thread::getCurrentThreadId();
+
+    for (int t = 1; t < maxNumThreads; ++t)
+        if (workerThreadIds[t].get() == thisThread)
+            return true;
+
+    return false;
+}
+
+void StripRenderPool::renderStrips(AudioSampleBuffer &output, const StripEventRouter &events,
+                                   const int &numStrips, const int &numSamples)
+{
+    currentEvents = &events;
+    currentNumStrips = numStrips;
+    currentNumSamples = numSamples;
+
+    // set the workers going...
+    for (int t = 1; t < numThreads; ++t)
+        shareStates[t] = shareWaiting;
+
+    for (int w = 0; w < workers.size(); ++w)
+        workers.getUnchecked(w)->notify();
+
+    // ...while doing our share here
+    const int64 startTicks = Time::getHighResolutionTicks();
+    renderShare(0);
+    const int64 ourShareTicks = Time::getHighResolutionTicks() - startTicks;
+
+    // The workers started at the same time as us on shares about the same
+    // size as ours, so give them about as long again (plus a little).
+    const int64 spinDeadline = Time::getHighResolutionTicks() + ourShareTicks
+                               + Time::getHighResolutionTicksPerSecond() / 10000;
+
+    for (int t = 1; t < numThreads; ++t)
+    {
+        while (shareStates[t].get() == shareWaiting && Time::getHighResolutionTicks() < spinDeadline)
+            Thread::yield();
+
+        // if its worker still hasn't started (e.g. it wasn't
+        // scheduled in time) then it's quicker to do it ourselves
+        tryRenderShare(t);
+    }
+
+    // a worker which has started is running, so won't be long
+    for (int t = 1; t < numThreads; ++t)
+        while (shareStates[t].get() != shareDone)
+            Thread::yield();
+
+    // always sum in the same order so the result is deterministic
+    for (int t = 0; t < numThreads; ++t)
+    {
+        output.addFrom(0, 0, *mixBuffers.getUnchecked(t), 0, 0, numSamples);
+        output.addFrom(1, 0, *mixBuffers.getUnchecked(t), 1, 0, numSamples);
+    }
+}
+
+bool StripRenderPool::tryRenderShare(const int &shareIndex)
+{
+    if (! shareStates[shareIndex].compareAndSetBool(shareRendering, shareWaiting))
+        return false;
+
+    renderShare(shareIndex);
+    shareStates[shareIndex] = shareDone;
+    return true;
+}
+
+void StripRenderPool::renderShare(const int &shareIndex)
+{
+    AudioSampleBuffer &scratch = *scratchBuffers.getUnchecked(shareIndex);
+    AudioSampleBuffer &mix = *mixBuffers.getUnchecked(shareIndex);
+
+    // make sure the buffers are *exactly* the right
+    // size and avoid reallocating if possible
+    scratch.setSize(2, currentNumSamples, false, false, true);
+    mix.setSize(2, currentNumSamples, false, false, true);
+    mix.clear();
+
+    for (int s = shareIndex; s < currentNumStrips; s += numThreads)
+        processor->renderSampleStrip(s, scratch, mix, *currentEvents, currentNumSamples);
+}
+
+void StripRenderPool::stopWorkers()
+{
+    for (int w = 0; w < workers.size(); ++w)
+        workers.getUnchecked(w)->signalThreadShouldExit();
+
+    for (int w = 0; w < workers.size(); ++w)
+        workers.getUnchecked(w)->stopThread(1000);
+
+    workers.clear(true);
+
+    for (int t = 0; t < maxNumThreads; ++t)
+        workerThreadIds[t] = nullptr;
+}
+
+void StripRenderPool::resizeBuffers(const int &numSamples)
+{
+    bufferSize = numSamples;
+
+    scratchBuffers.clear(true);
+    mixBuffers.clear(true);
+
+    for (int t = 0; t < numThreads; ++t)
+    {
+        scratchBuffers.add(new AudioSampleBuffer(2, jmax(1, bufferSize)));
+        mixBuffers.add(new AudioSampleBuffer(2, jmax(1, bufferSize)));
+    }
+}
+
+
+void StripRenderPool::Worker::run()
+{
+    while (! threadShouldExit())
+    {
+        // wait for the audio thread to give us a block to render
+        wait(-1);
+
+        if (threadShouldExit())
+            break;
+
+        // keep up with the audio thread's block size
+        const int periodMs = pool.blockPeriodMs.get();
+        if (periodMs != realtimePeriodMs)
+        {
+            setCurrentThreadToRealtime(periodMs);
+            realtimePeriodMs = periodMs;
+        }
+
+        // (the audio thread may have got to it first)
+        pool.tryRenderShare(shareIndex);
+    }
+}
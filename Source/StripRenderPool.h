@@ -0,0 +1,113 @@
+/*
+  ==============================================================================
+
+    StripRenderPool.h
+    Created: 18 Oct 2026 2:47:10pm
+    Author:  hemmer
+
+    Optionally spreads the SampleStrip rendering over several threads. The
+    audio thread renders one share of the strips itself while the worker
+    threads render the rest, each into their own preallocated buffers.
+    Strips are always given to the same share (strip s goes to share
+    s % numThreads) and the shares are summed in order, so the output
+    doesn't depend on which thread finishes first.
+
+    The audio thread never blocks on a worker: once it has done its own
+    share it spins (yielding) for a while, and then renders any share
+    whose worker still hasn't started on it itself.
+
+  ==============================================================================
+*/
+
+#ifndef STRIPRENDERPOOL_H_INCLUDED
+#define STRIPRENDERPOOL_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "StripEventRouter.h"
+
+// forward declaration
+class mlrVSTAudioProcessor;
+
+class StripRenderPool
+{
+public:
+    StripRenderPool(mlrVSTAudioProcessor * const owner);
+    ~StripRenderPool();
+
+    enum { maxNumThreads = 8 };
+
+    // Total number of threads to render with (including the audio
+    // thread), so 1 means everything is done on the audio thread.
+    void setNumThreads(const int &newNumThreads);
+    int getNumThreads() const { return numThreads; }
+
+    // allocate the buffers ahead of time (and tell the workers how
+    // often they'll be needed, so they can be made real-time threads)
+    void prepareToPlay(const int &samplesPerBlock, const double &sampleRate);
+
+    // true if called from one of the worker threads
+    bool isWorkerThread() const;
+
+    // Renders all the strips and adds them to the output. This should
+    // only be called from the audio thread, and returns once every
+    // share has been rendered (by its worker or by the audio thread).
+    void renderStrips(AudioSampleBuffer &output, const StripEventRouter &events,
+                      const int &numStrips, const int &numSamples);
+
+private:
+
+    class Worker : public Thread
+    {
+    public:
+        Worker(StripRenderPool &owner, const int &index)
+            : Thread("mlrVST strip renderer " + String(index)),
+              pool(owner), shareIndex(index), realtimePeriodMs(0)
+        {}
+
+        void run();
+
+    private:
+        StripRenderPool &pool;
+        const int shareIndex;
+        // the block period this thread's real-time settings are for
+        int realtimePeriodMs;
+
+        JUCE_DECLARE_NON_COPYABLE(Worker);
+    };
+
+    // renders the strips belonging to this share into its mix buffer
+    void renderShare(const int &shareIndex);
+    // renders the share if nobody else has started on it yet
+    bool tryRenderShare(const int &shareIndex);
+
+    void stopWorkers();
+    void resizeBuffers(const int &numSamples);
+
+    mlrVSTAudioProcessor * const processor;
+
+    int numThreads, bufferSize;
+    OwnedArray<Worker> workers;
+    // kept separately so they can be checked from any thread
+    Atomic<Thread::ThreadID> workerThreadIds[maxNumThreads];
+
+    // one of each per share, the strip is rendered into the
+    // scratch buffer and added (with gain) to the mix buffer
+    OwnedArray<AudioSampleBuffer> scratchBuffers, mixBuffers;
+
+    // each share goes from waiting to rendering (claimed by whichever
+    // thread gets there first) to done
+    enum ShareState { shareWaiting, shareRendering, shareDone };
+    Atomic<int> shareStates[maxNumThreads];
+
+    // how often the workers are needed (ms), for their real-time settings
+    Atomic<int> blockPeriodMs;
+
+    // the block currently being rendered
+    const StripEventRouter *currentEvents;
+    int currentNumStrips, currentNumSamples;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StripRenderPool);
+};
+
+
+#endif  // STRIPRENDERPOOL_H_INCLUDED
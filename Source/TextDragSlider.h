@@ -11,7 +11,7 @@
 #ifndef __TEXTDRAGSLIDER_H_B7B5D53F__
 #define __TEXTDRAGSLIDER_H_B7B5D53F__
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 
 
 class TextDragSlider  : public Component,
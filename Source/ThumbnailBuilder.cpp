@@ -0,0 +1,110 @@
+/*
+  ==============================================================================
+
+    ThumbnailBuilder.cpp
+    Created: 18 Oct 2026 11:02:37pm
+    Author:  hemmer
+
+  ==============================================================================
+*/
+
+#include "ThumbnailBuilder.h"
+#include "AudioSample.h"
+#include "PeakPyramid.h"
+
+ThumbnailBuilder::ThumbnailBuilder() :
+    Thread("mlrVST thumbnail builder"),
+    // leave a core free for the audio thread
+    numWorkers(jlimit(1, 4, SystemStats::getNumCpus() - 1)),
+    workers(numWorkers),
+    requestFifo(requestQueueSize), isBuilding(0)
+{
+    workers.setThreadPriorities(3);
+}
+
+ThumbnailBuilder::~ThumbnailBuilder()
+{
+    stopThread(4000);
+    workers.removeAllJobs(true, 4000);
+}
+
+bool ThumbnailBuilder::requestRebuild(AudioSample *sample)
+{
+    int start1, size1, start2, size2;
+    requestFifo.prepareToWrite(1, start1, size1, start2, size2);
+
+    if (size1 + size2 < 1)
+        return false;
+
+    requests[size1 > 0 ? start1 : start2] = sample;
+    requestFifo.finishedWrite(1);
+
+    notify();
+    return true;
+}
+
+bool ThumbnailBuilder::isIdle() const
+{
+    return requestFifo.getNumReady() == 0 && isBuilding.get() == 0;
+}
+
+void ThumbnailBuilder::fillPyramid(const AudioSample &sample, PeakPyramid &pyramid)
+{
+    const int numFrames = pyramid.getNumFrames();
+
+    // Each segment is a whole number of peaks, and not so small
+    // that it isn't worth handing to another thread.
+    const int minSegmentLength = PeakPyramid::framesPerPeak * 1024;
+    int segmentLength = jmax(minSegmentLength, 1 + (numFrames - 1) / numWorkers);
+    segmentLength = PeakPyramid::framesPerPeak * (1 + (segmentLength - 1) / PeakPyramid::framesPerPeak);
+
+    if (segmentLength >= numFrames)
+    {
+        // not worth splitting up
+        sample.fillThumbnail(pyramid, 0, numFrames);
+        return;
+    }
+
+    OwnedArray<SegmentJob> jobs;
+
+    for (int start = 0; start < numFrames; start += segmentLength)
+    {
+        SegmentJob *job = jobs.add(new SegmentJob(sample, pyramid, start,
+                                                  jmin(segmentLength, numFrames - start)));
+        workers.addJob(job, false);
+    }
+
+    for (int j = 0; j < jobs.size(); ++j)
+        workers.waitForJobToFinish(jobs.getUnchecked(j), -1);
+}
+
+void ThumbnailBuilder::run()
+{
+    while (! threadShouldExit())
+    {
+        // wait for the audio thread to ask for something
+        wait(-1);
+
+        while (requestFifo.getNumReady() > 0 && ! threadShouldExit())
+        {
+            // (set before the request is taken so we never look idle in between)
+            isBuilding = 1;
+
+            int start1, size1, start2, size2;
+            requestFifo.prepareToRead(1, start1, size1, start2, size2);
+
+            AudioSample *sample = requests[size1 > 0 ? start1 : start2];
+            requestFifo.finishedRead(1);
+
+            sample->buildThumbnail(this);
+            isBuilding = 0;
+        }
+    }
+}
+
+
+ThreadPoolJob::JobStatus ThumbnailBuilder::SegmentJob::runJob()
+{
+    sample.fillThumbnail(pyramid, startFrame, numFrames);
+    return jobHasFinished;
+}
@@ -0,0 +1,89 @@
+/*
+  ==============================================================================
+
+    ThumbnailBuilder.h
+    Created: 18 Oct 2026 11:02:37pm
+    Author:  hemmer
+
+    Makes AudioSample thumbnails away from the audio thread. When a
+    recording / resampling finishes, the audio thread just queues the
+    sample (without locking or allocating) and the builder's thread
+    remakes its thumbnail. The actual scanning of the audio is split
+    into segments which are shared between a small pool of threads, and
+    the loaders use this too when a file is loaded.
+
+  ==============================================================================
+*/
+
+#ifndef THUMBNAILBUILDER_H_INCLUDED
+#define THUMBNAILBUILDER_H_INCLUDED
+
+#include "JuceHeader.h"
+
+// forward declarations
+class AudioSample;
+class PeakPyramid;
+
+class ThumbnailBuilder : public Thread
+{
+public:
+    ThumbnailBuilder();
+    ~ThumbnailBuilder();
+
+    /* Asks for the sample's thumbnail to be rebuilt. This doesn't lock or
+       allocate so is safe for the audio thread (and should only be called
+       from there). Returns false if the queue was full.
+    */
+    bool requestRebuild(AudioSample *sample);
+
+    /* True if there are no thumbnails being built or waiting to be
+       built, i.e. any buffer a sample has just given up can be reused.
+    */
+    bool isIdle() const;
+
+    /* Fills in the finest level of the pyramid with the sample's audio,
+       sharing the work between the worker threads. This blocks until the
+       whole sample has been scanned.
+    */
+    void fillPyramid(const AudioSample &sample, PeakPyramid &pyramid);
+
+    // Thread
+    void run();
+
+private:
+
+    class SegmentJob : public ThreadPoolJob
+    {
+    public:
+        SegmentJob(const AudioSample &sampleToScan, PeakPyramid &pyramidToFill,
+                   const int &segmentStart, const int &segmentLength)
+            : ThreadPoolJob("mlrVST thumbnail segment"),
+              sample(sampleToScan), pyramid(pyramidToFill),
+              startFrame(segmentStart), numFrames(segmentLength)
+        {}
+
+        JobStatus runJob();
+
+    private:
+        const AudioSample &sample;
+        PeakPyramid &pyramid;
+        const int startFrame, numFrames;
+
+        JUCE_DECLARE_NON_COPYABLE(SegmentJob);
+    };
+
+    const int numWorkers;
+    ThreadPool workers;
+
+    // samples waiting for their thumbnails (from the audio thread)
+    enum { requestQueueSize = 32 };
+    AbstractFifo requestFifo;
+    AudioSample* requests[requestQueueSize];
+    // set while run() is working on a request
+    Atomic<int> isBuilding;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ThumbnailBuilder);
+};
+
+
+#endif  // THUMBNAILBUILDER_H_INCLUDED
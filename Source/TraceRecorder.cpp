@@ -0,0 +1,171 @@
+/*
+  ==============================================================================
+
+    TraceRecorder.cpp
+    Created: 19 Oct 2026 6:14:52am
+    Author:  hemmer
+
+  ==============================================================================
+*/
+
+#include "TraceRecorder.h"
+
+TraceRecorder::TraceRecorder() :
+    numRecorded(0)
+{
+    static_jassert((ringSize & (ringSize - 1)) == 0);
+
+    for (int i = 0; i < ringSize; ++i)
+    {
+        ring[i].sequence = 0;
+        ring[i].ticks = 0;
+        ring[i].thread = nullptr;
+        ring[i].type = ring[i].arg1 = ring[i].arg2 = 0;
+    }
+}
+
+const char* TraceRecorder::getEventName(const int &type)
+{
+    switch (type)
+    {
+    case evPressReceived :  return "press received";
+    case evPressQueued :    return "press queued";
+    case evNoteRendered :   return "note rendered";
+    case evPatternWrap :    return "pattern wrap";
+    case evCaptureStart :   return "capture start";
+    case evCaptureFinish :  return "capture finish";
+    case evLEDSend :        return "led send";
+    default :               jassertfalse; return "";
+    }
+}
+
+void TraceRecorder::record(const int &type, const int &arg1, const int &arg2)
+{
+    // claim the next slot (the ring is big enough that two
+    // threads won't be writing to the same one at once)
+    const uint32 index = ++numRecorded - 1;
+    Entry &e = ring[index & (ringSize - 1)];
+
+    e.sequence = 0;
+    e.ticks = Time::getHighResolutionTicks();
+    e.thread = Thread::getCurrentThreadId();
+    e.type = type;
+    e.arg1 = arg1;
+    e.arg2 = arg2;
+    e.sequence = index + 1;
+}
+
+namespace
+{
+    // what the arguments of each event are called in the trace
+    void getArgNames(const int &type, const char *&arg1, const char *&arg2)
+    {
+        arg1 = arg2 = nullptr;
+
+        switch (type)
+        {
+        case TraceRecorder::evPressReceived :   arg1 = "col";       arg2 = "row";       break;
+        case TraceRecorder::evPressQueued :     arg1 = "strip";     arg2 = "col";       break;
+        case TraceRecorder::evNoteRendered :    arg1 = "strip";     arg2 = "col";       break;
+        case TraceRecorder::evPatternWrap :     arg1 = "pattern";                       break;
+        case TraceRecorder::evCaptureStart :    arg1 = "resample";  arg2 = "bank";      break;
+        case TraceRecorder::evCaptureFinish :   arg1 = "resample";                      break;
+        case TraceRecorder::evLEDSend :         arg1 = "messages";  arg2 = "bytes";     break;
+        default : break;
+        }
+    }
+
+    struct EntryCopy
+    {
+        int64 ticks;
+        Thread::ThreadID thread;
+        int type, arg1, arg2;
+    };
+
+    struct EntrySorter
+    {
+        static int compareElements(const int64 a, const int64 b) { return (a < b) ? -1 : ((b < a) ? 1 : 0); }
+    };
+}
+
+bool TraceRecorder::writeChromeTrace(const File &file, Thread::ThreadID audioThread) const
+{
+    // take a copy of the ring, skipping anything being written as we go
+    Array<EntryCopy> copies;
+    copies.ensureStorageAllocated(ringSize);
+
+    for (int i = 0; i < ringSize; ++i)
+    {
+        const Entry &e = ring[i];
+        const uint32 sequence = e.sequence.get();
+        if (sequence == 0) continue;
+
+        EntryCopy c;
+        c.ticks = e.ticks;
+        c.thread = e.thread;
+        c.type = e.type;
+        c.arg1 = e.arg1;
+        c.arg2 = e.arg2;
+
+        // (if it changed while we read it, it's newer than this dump anyway)
+        if (e.sequence.get() == sequence && c.type >= 0 && c.type < numEventTypes)
+            copies.add(c);
+    }
+
+    if (copies.size() == 0) return false;
+
+    // the ring wraps, so put everything back in order
+    int64 firstTicks = copies.getReference(0).ticks;
+    for (int i = 1; i < copies.size(); ++i)
+        firstTicks = jmin(firstTicks, copies.getReference(i).ticks);
+
+    Array<int64> order;     // (ticks from the start << 16 | index in copies)
+    order.ensureStorageAllocated(copies.size());
+    for (int i = 0; i < copies.size(); ++i)
+        order.add(((copies.getReference(i).ticks - firstTicks) << 16) | i);
+    EntrySorter sorter;
+    order.sort(sorter);
+
+    // threads are numbered in the order they first appear
+    Array<Thread::ThreadID> threads;
+
+    const double microsecondsPerTick = 1.0e6 / (double) Time::getHighResolutionTicksPerSecond();
+
+    String json;
+    json.preallocateBytes(copies.size() * 128);
+    json << "{\"traceEvents\":[\n";
+
+    for (int i = 0; i < order.size(); ++i)
+    {
+        const EntryCopy &c = copies.getReference((int) (order.getUnchecked(i) & 0xffff));
+
+        int tid = threads.indexOf(c.thread);
+        if (tid < 0)
+        {
+            tid = threads.size();
+            threads.add(c.thread);
+        }
+
+        const char *arg1Name, *arg2Name;
+        getArgNames(c.type, arg1Name, arg2Name);
+
+        json << "{\"name\":\"" << getEventName(c.type) << "\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":" << tid
+             << ",\"ts\":" << String((c.ticks - firstTicks) * microsecondsPerTick, 3) << ",\"args\":{";
+        if (arg1Name != nullptr) json << "\"" << arg1Name << "\":" << c.arg1;
+        if (arg2Name != nullptr) json << ",\"" << arg2Name << "\":" << c.arg2;
+        json << "}},\n";
+    }
+
+    // and name them, so the audio thread is easy to find
+    for (int t = 0; t < threads.size(); ++t)
+    {
+        const String name((threads.getUnchecked(t) == audioThread && audioThread != nullptr)
+                              ? String("audio") : "thread " + String(t));
+        json << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << t
+             << ",\"args\":{\"name\":\"" << name << "\"}}" << (t < threads.size() - 1 ? ",\n" : "\n");
+    }
+
+    json << "]}\n";
+
+    return file.replaceWithText(json);
+}
@@ -0,0 +1,72 @@
+/*
+  ==============================================================================
+
+    TraceRecorder.h
+    Created: 19 Oct 2026 6:14:52am
+    Author:  hemmer
+
+    Keeps a record of the last few thousand things that happened to a
+    press on its way to being heard (received over OSC, queued, played by
+    a strip) along with pattern loops, takes and LED packets, each with
+    the time and the thread it happened on. Recording an event doesn't
+    lock or allocate, so it's fine on the audio thread and is always on
+    (unlike DBG). The ring can then be written out in the Chrome trace
+    format, which chrome://tracing or Perfetto will show per thread.
+
+  ==============================================================================
+*/
+
+#ifndef TRACERECORDER_H_INCLUDED
+#define TRACERECORDER_H_INCLUDED
+
+#include "JuceHeader.h"
+
+
+class TraceRecorder
+{
+public:
+    TraceRecorder();
+
+    enum EventType
+    {
+        evPressReceived,    // OSC press arrived: column, row
+        evPressQueued,      // press passed to the audio thread: strip, column
+        evNoteRendered,     // a strip started playing a note: strip, column
+        evPatternWrap,      // a pattern went back to its start: pattern
+        evCaptureStart,     // a take started: 0 = record / 1 = resample, bank
+        evCaptureFinish,    // a take finished: 0 = record / 1 = resample
+        evLEDSend,          // a packet went to the monome: messages, bytes
+        numEventTypes
+    };
+
+    enum { ringSize = 1 << 15 };    // (must be a power of two)
+
+    static const char* getEventName(const int &type);
+
+    // (any thread) adds an event to the ring, overwriting the oldest
+    void record(const int &type, const int &arg1 = 0, const int &arg2 = 0);
+
+    /* Writes everything in the ring to a Chrome trace (JSON) file. The
+       audio thread's events are labelled as such if its ID is given.
+       Don't call this from the audio thread.
+    */
+    bool writeChromeTrace(const File &file, Thread::ThreadID audioThread = nullptr) const;
+
+private:
+
+    struct Entry
+    {
+        Atomic<uint32> sequence;    // which write this is (+1), or 0 while it's being written
+        int64 ticks;
+        Thread::ThreadID thread;
+        int type, arg1, arg2;
+    };
+
+    Entry ring[ringSize];
+    Atomic<uint32> numRecorded;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TraceRecorder);
+};
+
+
+#endif  // TRACERECORDER_H_INCLUDED
@@ -50,10 +50,9 @@ mlrVSTGUI::mlrVSTGUI (mlrVSTAudioProcessor* owner, const int &newNumChannels, co
     patternBtn("pattern", Colours::black, Colours::white),
 
     // branding
-    vstNameLbl("vst label", "mlrVST"),
+    vstNameLbl("vst label", "mlrVST"), dspLoadLbl("dsp load", String::empty),
 
     // Misc ///////////////////////////////////////////
-    lastDisplayedPosition(),
     debugButton("loadfile", DrawableButton::ImageRaw),    // temporary button
 
     // Presets //////////////////////////////////////////////////
@@ -145,6 +144,10 @@ mlrVSTGUI::mlrVSTGUI (mlrVSTAudioProcessor* owner, const int &newNumChannels, co
     vstNameLbl.setFont(Font("ProggyCleanTT", 40.f, Font::plain));
     vstNameLbl.setColour(Label::textColourId, Colours::white);
 
+    addAndMakeVisible(&dspLoadLbl);
+    dspLoadLbl.setBounds(PAD_AMOUNT + 250, 615, 300, 20);
+    dspLoadLbl.setColour(Label::textColourId, Colours::white);
+
     addChildComponent(&hintOverlay);
     const int overlayHeight = 150;
     hintOverlay.setBounds(0, GUI_HEIGHT/2 - overlayHeight/2, GUI_WIDTH, overlayHeight);
@@ -233,16 +236,8 @@ void mlrVSTGUI::changeListenerCallback(ChangeBroadcaster *)
 {
     DBG("CHANGE");
 
-    if (useExternalTempo)
-    {
-        AudioPlayHead::CurrentPositionInfo newPos(parent->lastPosInfo);
-        if (lastDisplayedPosition != newPos) bpmSlider.setValue(newPos.bpm);
-    }
-    else
-    {
-        const double currentBPM = *static_cast<const double*>(parent->getGlobalSetting(GlobalSettings::sCurrentBPM));
-        bpmSlider.setValue(currentBPM);
-    }
+    // (the tempo is picked up from the GUI state in timerCallback, as it
+    // can be changed by the host on the audio thread)
 
     const int newNumChannels = *static_cast<const int*>(parent->getGlobalSetting(GlobalSettings::sNumChannels));
     if (newNumChannels != numChannels)
@@ -294,20 +289,16 @@ void mlrVSTGUI::changeListenerCallback(ChangeBroadcaster *)
 // to see if the host has modified the parameters.
 void mlrVSTGUI::timerCallback()
 {
-    if (parent->areWeRecording())
-        recordBtn.setPercentDone(parent->getRecordingPrecountPercent(),
-        parent->getRecordingPercent());
-    else recordBtn.setPercentDone(0.0, 0.0);
-
-    if (parent->areWeResampling())
-        resampleBtn.setPercentDone(parent->getResamplingPrecountPercent(),
-        parent->getResamplingPercent());
-    else resampleBtn.setPercentDone(0.0, 0.0);
-
-    if (parent->isPatternRecording())
-        patternBtn.setPercentDone(parent->getPatternPrecountPercent(),
-        parent->getPatternPercent());
-    else patternBtn.setPercentDone(0.0, 0.0);
+    // (the peak and any overruns are kept until the peaks are reset over OSC)
+    const ProcessProfiler &profiler = parent->getProfiler();
+    String dspLoad;
+    dspLoad << "dsp " << roundToInt(100.0f * profiler.getLoad()) << "% (peak "
+            << roundToInt(100.0f * profiler.getPeakLoad()) << "%)";
+    if (profiler.getNumOverruns() > 0)
+        dspLoad << ", " << profiler.getNumOverruns() << " overruns (last: "
+                << ProcessProfiler::getStageName(profiler.getLastOverrunStage())
+                << ", strip " << profiler.getLastOverrunStrip() << ")";
+    dspLoadLbl.setText(dspLoad, NotificationType::dontSendNotification);
 
     // see if the modifier button status has changed
     const int modifierStatus = parent->getModifierBtnState();
@@ -317,21 +308,45 @@ void mlrVSTGUI::timerCallback()
     else
         hintOverlay.setVisible(false);
 
+    // Everything else comes from the audio thread's latest state, so if
+    // it hasn't published one since last time there is nothing to do.
+    GUIStateSnapshot &guiState = parent->getGUIState();
+    if (!guiState.update()) return;
+
+    const GUIStateSnapshot::State &state = guiState.getState();
+
+    if (state.isRecording)
+        recordBtn.setPercentDone(state.recordPrecountPercent, state.recordPercent);
+    else recordBtn.setPercentDone(0.0, 0.0);
+
+    if (state.isResampling)
+        resampleBtn.setPercentDone(state.resamplePrecountPercent, state.resamplePercent);
+    else resampleBtn.setPercentDone(0.0, 0.0);
+
+    const bool isCurrentPatternValid = state.currentPatternBank >= 0 && state.currentPatternBank < state.numPatterns;
+    if (isCurrentPatternValid && state.patterns[state.currentPatternBank].isRecording)
+    {
+        const GUIStateSnapshot::PatternState &pattern = state.patterns[state.currentPatternBank];
+        patternBtn.setPercentDone(pattern.precountPercent, pattern.percent);
+    }
+    else patternBtn.setPercentDone(0.0, 0.0);
+
+    // (the snapshot lags behind the slider, so leave it alone while it's being dragged)
+    if (state.currentBPM != bpmSlider.getValue() && !bpmSlider.isMouseButtonDown())
+        bpmSlider.setValue(state.currentBPM, NotificationType::dontSendNotification);
+
     if (displayMode == modeSampleStrips)
     {
-        // update the playback position
-        for(int i = 0; i < sampleStripControlArray.size(); ++i)
-        {
-            sampleStripControlArray[i]->updatePlaybackStatus();
-            sampleStripControlArray[i]->updateParamsIfChanged();
-        }
+        // (each strip only redraws if it has changed)
+        const int numStripsToUpdate = jmin(sampleStripControlArray.size(), state.numStrips);
+        for (int i = 0; i < numStripsToUpdate; ++i)
+            sampleStripControlArray[i]->updateFromState(state.strips[i]);
     }
-    else if(displayMode == modePatternStrips)
+    else if (displayMode == modePatternStrips)
     {
-        for(int i = 0; i < patternStripArray.size(); ++i)
-        {
-            patternStripArray[i]->repaint();
-        }
+        const int numPatternsToUpdate = jmin(patternStripArray.size(), state.numPatterns);
+        for (int i = 0; i < numPatternsToUpdate; ++i)
+            patternStripArray[i]->updateFromState(state.patterns[i]);
     }
 }
 
@@ -523,13 +538,10 @@ void mlrVSTGUI::buttonClicked(Button* btn)
         // ask user to load at least one file
         if(myChooser.browseForMultipleFilesToOpen())
         {
-            // if sucessful, try to add these to the sample pool
+            // if sucessful, add these to the sample pool (in the background)
             Array<File> newFiles = myChooser.getResults();
             for (int i = 0; i < newFiles.size(); ++i)
-            {
-                File currentFile = newFiles[i];
-                parent->addNewSample(currentFile);
-            }
+                parent->loadSampleAsync(newFiles[i]);
         }
     }
 
@@ -3,7 +3,7 @@
 
 
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 #include "PluginProcessor.h"
 #include "SampleStripControl.h"
 #include "PresetPanel.h"
@@ -121,10 +121,10 @@ private:
     void setUpRecordResampleUI();
 
     Label vstNameLbl;
+    // how much of each block processBlock is using (see ProcessProfiler)
+    Label dspLoadLbl;
 
     // Misc /////////////////////
-    // this object is used to store bpm information from the host
-    AudioPlayHead::CurrentPositionInfo lastDisplayedPosition;
     DrawableButton debugButton;
 
     // Panels ///////////////////////
@@ -6,7 +6,7 @@
 #ifndef __JUCE_mlrVSTLookAndFeel_JUCEHEADER__
 #define __JUCE_mlrVSTLookAndFeel_JUCEHEADER__
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 #include "Fonts/FreeTypeFaces.h"
 
 
@@ -11,7 +11,7 @@
 #ifndef __TIMEDBUTTON_H_5AC4D4C1__
 #define __TIMEDBUTTON_H_5AC4D4C1__
 
-#include "../JuceLibraryCode/JuceHeader.h"
+#include "JuceHeader.h"
 
 class TimedButton  : public Button
 {
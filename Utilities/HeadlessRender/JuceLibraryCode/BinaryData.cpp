@@ -0,0 +1,600 @@
+/* ==================================== JUCER_BINARY_RESOURCE ====================================
+
+   This is an auto-generated file: Any edits you make may be overwritten!
+
+*/
+
+namespace BinaryData
+{
+
+//================== locked.png ==================
+static const unsigned char temp_79dbd4da[] =
+{ 137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,18,0,0,0,18,8,3,0,0,0,97,16,126,101,0,0,3,0,80,76,84,69,0,0,0,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,103,118,236,99,0,0,0,1,116,82,78,83,0,64,230,216,102,0,0,0,1,98,75,71,68,0,136,5,29,72,0,0,0,9,112,72,
+89,115,0,0,14,194,0,0,14,194,1,21,40,74,128,0,0,0,7,116,73,77,69,7,221,6,22,20,11,24,115,241,18,131,0,0,0,37,73,68,65,84,24,211,99,96,32,5,48,2,1,166,8,170,24,152,139,42,6,225,32,11,193,216,72,98,196,10,193,192,0,10,17,4,0,60,11,0,103,1,32,124,221,0,
+0,0,0,73,69,78,68,174,66,96,130,0,0 };
+
+const char* locked_png = (const char*) temp_79dbd4da;
+
+//================== unlocked.png ==================
+static const unsigned char temp_9d8a6f3[] =
+{ 137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,18,0,0,0,18,8,3,0,0,0,97,16,126,101,0,0,3,0,80,76,84,69,0,0,0,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,103,118,236,99,0,0,0,1,116,82,78,83,0,64,230,216,102,0,0,0,1,98,75,71,68,0,136,5,29,72,0,0,0,9,112,72,
+89,115,0,0,14,195,0,0,14,195,1,199,111,168,100,0,0,0,7,116,73,77,69,7,221,6,22,20,18,28,239,156,127,130,0,0,0,45,73,68,65,84,24,211,99,96,196,0,12,120,133,24,128,0,85,136,129,1,42,198,128,36,2,35,16,66,48,146,176,16,212,120,6,6,184,201,131,74,136,136,
+240,2,0,163,9,0,235,14,192,201,156,0,0,0,0,73,69,78,68,174,66,96,130,0,0 };
+
+const char* unlocked_png = (const char*) temp_9d8a6f3;
+
+//================== waveform.png ==================
+static const unsigned char temp_6bbb3a4d[] =
+{ 137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,70,0,0,0,25,8,6,0,0,0,140,246,88,166,0,0,0,4,103,65,77,65,0,0,177,143,11,252,97,5,0,0,0,9,112,72,89,115,0,0,14,196,0,0,14,196,1,149,43,14,27,0,0,1,169,73,68,65,84,88,71,237,151,93,142,194,48,12,132,
+57,84,223,57,0,135,234,9,144,56,64,15,192,229,120,232,35,79,172,92,50,200,157,142,219,252,160,93,105,149,79,178,26,59,246,36,140,64,42,167,87,71,178,50,102,158,231,180,234,172,140,57,157,250,23,8,116,99,2,54,198,176,57,143,199,35,173,218,104,209,249,
+214,29,74,144,198,220,110,183,84,105,255,22,65,171,69,167,245,14,53,72,99,252,69,108,61,12,67,202,202,129,86,139,78,235,29,106,102,179,140,241,121,9,207,231,115,165,137,176,122,14,214,139,39,214,37,224,156,146,51,65,182,49,211,52,165,202,27,206,21,94,
+143,99,15,104,91,159,173,115,102,60,126,30,79,104,229,18,26,115,62,159,55,53,15,231,10,63,203,1,125,5,246,121,38,7,204,225,105,148,106,24,171,78,47,0,17,206,129,170,121,252,92,20,10,213,231,195,195,185,193,253,42,24,85,95,178,251,253,190,26,68,112,221,
+242,168,230,195,239,31,133,245,143,227,184,132,218,231,80,103,212,158,171,102,172,246,49,134,55,127,59,174,215,235,18,106,239,47,226,99,140,17,54,80,110,68,53,224,247,143,194,163,246,57,192,81,237,40,64,88,79,207,5,213,132,245,229,114,89,114,160,106,
+30,219,195,108,20,138,189,57,62,79,157,207,243,42,103,84,45,52,230,243,91,75,57,163,106,12,102,85,64,95,17,253,254,115,129,62,102,48,191,119,38,19,26,3,56,47,193,235,113,228,128,190,146,25,79,203,252,170,27,2,94,164,70,212,99,179,254,157,100,239,253,
+133,65,239,55,238,80,74,150,49,37,111,140,12,180,90,116,90,239,80,51,43,141,241,255,43,240,193,106,241,255,87,106,105,189,67,13,27,99,90,254,197,254,39,54,198,116,222,116,99,2,186,19,1,221,24,201,235,245,3,15,255,149,184,177,30,88,162,0,0,0,0,73,69,78,
+68,174,66,96,130,0,0 };
+
+const char* waveform_png = (const char*) temp_6bbb3a4d;
+
+//================== pattern.png ==================
+static const unsigned char temp_53ef15d6[] =
+{ 137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,70,0,0,0,25,8,6,0,0,0,140,246,88,166,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,0,4,103,65,77,65,0,0,177,143,11,252,97,5,0,0,0,9,112,72,89,115,0,0,14,194,0,0,14,194,1,21,40,74,128,0,0,1,84,73,68,65,84,
+88,71,237,151,189,138,132,64,12,128,227,41,118,171,149,181,133,182,86,130,149,207,99,35,62,134,54,62,155,34,246,90,248,8,86,254,239,221,64,238,192,219,61,102,78,87,25,93,63,24,76,2,3,33,230,111,132,251,23,112,241,192,7,126,47,126,241,16,24,211,52,65,
+16,4,230,115,86,102,129,233,186,14,84,85,69,237,189,153,245,152,190,239,193,247,125,72,146,4,100,89,70,235,115,200,181,166,105,32,203,50,180,108,71,85,85,160,235,58,104,154,134,150,191,169,235,26,226,56,134,32,8,208,178,16,18,152,111,134,97,64,137,47,
+202,178,36,63,143,249,132,97,136,55,151,51,43,37,81,20,81,226,139,105,154,80,98,99,28,71,148,150,179,203,184,38,13,189,40,10,212,232,236,224,18,149,93,198,245,17,27,250,46,25,227,121,30,119,13,157,10,9,12,13,195,48,126,26,27,203,225,129,181,62,51,149,
+210,17,75,97,173,207,76,165,116,196,82,88,235,51,55,143,200,182,109,153,214,5,226,46,121,138,72,146,132,150,109,224,38,48,255,121,119,89,150,5,121,158,163,182,13,187,140,235,87,115,187,221,80,218,14,110,50,198,117,93,80,20,133,154,57,164,228,28,199,129,
+40,138,208,178,13,76,129,57,226,230,186,150,211,142,235,181,156,118,92,175,205,114,110,122,204,171,177,109,27,210,52,69,141,206,219,4,230,52,11,30,111,28,114,143,217,131,43,48,79,1,248,4,83,123,125,186,145,156,77,195,0,0,0,0,73,69,78,68,174,66,96,130,
+0,0 };
+
+const char* pattern_png = (const char*) temp_53ef15d6;
+
+//================== ProggyClean.ttf ==================
+static const unsigned char temp_6d1849c0[] =
+{ 0,1,0,0,0,12,0,128,0,3,0,64,79,83,47,50,136,235,116,144,0,0,1,72,0,0,0,78,99,109,97,112,2,18,35,117,0,0,3,160,0,0,1,82,99,118,116,32,0,0,0,0,0,0,4,252,0,0,0,2,103,108,121,102,18,175,137,86,0,0,7,4,0,0,146,128,104,101,97,100,215,145,102,211,0,0,0,204,
+0,0,0,54,104,104,101,97,8,66,1,195,0,0,1,4,0,0,0,36,104,109,116,120,138,0,126,128,0,0,1,152,0,0,2,6,108,111,99,97,140,115,176,216,0,0,5,0,0,0,2,4,109,97,120,112,1,174,0,218,0,0,1,40,0,0,0,32,110,97,109,101,37,89,187,150,0,0,153,132,0,0,1,158,112,111,
+115,116,166,172,131,239,0,0,155,36,0,0,5,210,112,114,101,112,105,2,1,18,0,0,4,244,0,0,0,8,0,1,0,0,0,1,0,0,60,85,233,213,95,15,60,245,0,3,8,0,0,0,0,0,183,103,119,132,0,0,0,0,189,146,166,215,0,0,254,128,3,128,5,0,0,0,0,3,0,2,0,0,0,0,0,0,0,1,0,0,4,192,254,
+64,0,0,3,128,0,0,0,0,3,128,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,0,1,1,0,144,0,36,0,0,0,0,0,2,0,8,0,64,0,10,0,0,0,118,0,8,0,0,0,0,0,0,3,128,1,144,0,5,0,0,2,188,2,138,0,0,0,143,2,188,2,138,0,0,1,197,0,50,2,0,0,0,0,0,4,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,65,108,116,115,0,64,0,0,32,172,8,0,0,0,0,0,5,0,1,128,0,0,3,128,0,0,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,3,128,
+3,128,3,128,3,128,3,128,3,128,3,128,1,128,1,0,0,0,0,128,0,0,0,128,1,128,1,0,1,0,0,128,0,128,0,128,0,128,1,0,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,1,128,0,128,0,0,0,128,0,128,0,128,0,0,0,128,0,128,0,128,0,128,0,128,0,128,0,
+128,0,128,1,0,0,128,0,128,0,128,0,0,0,128,0,128,0,128,0,128,0,128,0,128,0,0,0,128,0,0,0,0,0,128,0,0,0,128,1,0,0,128,1,0,0,128,0,0,1,0,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,1,0,0,128,0,128,1,0,0,0,0,128,0,128,0,128,0,128,0,128,0,128,1,0,0,128,
+0,128,0,0,0,128,0,128,0,128,0,128,1,128,0,128,0,0,3,128,0,128,3,128,1,0,0,128,1,0,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,0,3,128,0,128,3,128,3,128,1,128,1,0,1,0,0,128,0,128,0,128,0,0,0,128,0,0,0,128,0,128,0,0,3,128,0,128,0,0,3,128,1,128,0,128,0,
+128,0,0,0,0,1,128,0,128,1,0,0,0,0,128,0,128,0,128,3,128,0,0,0,0,0,128,0,128,0,128,0,128,1,128,0,0,0,128,1,0,1,128,0,128,0,128,0,128,0,128,0,128,0,0,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,0,0,128,0,128,0,128,0,128,0,128,1,0,1,0,1,0,1,0,0,0,0,128,
+0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,0,0,128,0,0,0,128,0,128,0,128,0,128,0,128,0,128,0,0,0,128,0,128,0,128,0,128,0,128,1,0,1,0,1,0,1,0,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,
+0,128,0,128,0,0,0,0,0,3,0,0,0,0,0,0,0,28,0,1,0,0,0,0,0,76,0,3,0,1,0,0,0,28,0,4,0,48,0,0,0,8,0,8,0,2,0,0,0,127,0,255,32,172,255,255,0,0,0,0,0,129,32,172,255,255,0,1,0,1,223,213,0,1,0,0,0,0,0,0,0,0,0,0,1,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,177,0,1,141,184,1,255,133,
+0,0,0,0,0,0,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,198,0,244,1,28,1,158,2,20,2,136,2,252,
+3,20,3,88,3,156,3,222,4,20,4,50,4,80,4,98,4,162,5,22,5,102,5,188,6,18,6,116,6,214,7,56,7,126,7,236,8,78,8,108,8,150,8,208,9,16,9,74,9,136,10,22,10,128,11,4,11,86,11,200,12,46,12,130,12,234,13,94,13,164,13,234,14,80,14,150,15,40,15,176,16,18,16,116,16,
+224,17,82,17,182,18,4,18,110,18,196,19,76,19,172,19,246,20,88,20,174,20,234,21,64,21,128,21,166,21,184,22,18,22,126,22,198,23,52,23,142,23,224,24,86,24,186,24,238,25,54,25,150,25,212,26,72,26,156,26,240,27,92,27,200,28,4,28,76,28,150,28,234,29,42,29,
+146,29,210,30,64,30,142,30,224,31,36,31,118,31,166,31,166,32,16,32,16,32,46,32,138,32,178,32,200,33,20,33,116,33,152,33,238,34,98,34,134,35,12,35,12,35,128,35,128,35,128,35,152,35,176,35,216,36,0,36,74,36,104,36,144,36,174,37,6,37,96,37,130,37,248,37,
+248,38,88,38,170,38,170,38,216,39,64,39,154,40,10,40,104,40,168,41,14,41,32,41,184,41,248,42,54,42,96,42,96,43,2,43,42,43,94,43,172,43,230,44,32,44,52,44,154,45,40,45,92,45,120,45,170,45,232,46,38,46,166,47,38,47,182,47,244,48,94,48,200,49,62,49,180,
+50,30,50,158,51,30,51,130,51,238,52,92,52,206,53,58,53,134,53,212,54,38,54,114,54,230,55,118,55,216,56,58,56,166,57,18,57,116,57,174,58,46,58,154,59,6,59,124,59,232,60,58,60,150,61,34,61,134,61,236,62,86,62,198,63,42,63,154,64,18,64,106,64,208,65,54,
+65,162,66,8,66,64,66,122,66,184,66,240,67,98,67,204,68,42,68,138,68,238,69,88,69,182,69,226,70,84,70,180,71,20,71,122,71,218,72,84,72,198,73,64,0,36,0,0,254,128,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,
+67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,103,0,107,0,111,0,115,0,119,0,123,0,127,0,131,0,135,0,139,0,143,0,0,17,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,
+21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,
+51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,128,128,252,128,128,2,128,128,252,128,128,2,128,128,252,128,128,2,128,128,252,128,128,2,128,128,252,128,128,2,128,128,252,128,128,2,128,128,252,128,128,2,128,128,252,128,128,2,128,128,252,128,128,2,128,
+128,252,128,128,2,128,128,252,128,128,2,128,128,252,128,128,128,128,128,128,128,128,4,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,7,1,128,0,0,2,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,0,1,53,51,21,7,53,
+51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,3,53,51,21,1,128,128,128,128,128,128,128,128,128,128,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,255,0,128,128,0,6,1,0,3,0,2,128,4,128,0,3,0,7,0,11,0,15,0,
+19,0,23,0,0,1,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,1,0,128,128,128,254,128,128,128,128,254,128,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,24,0,0,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,
+0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,0,1,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,
+51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,1,128,128,128,128,254,128,128,128,128,253,128,128,128,128,128,128,128,253,128,128,128,128,254,128,128,128,128,253,128,128,128,128,
+128,128,128,253,128,128,128,128,254,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,0,0,21,0,128,255,128,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,0,1,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,51,53,51,21,5,53,
+51,21,51,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,1,128,128,255,0,128,128,128,128,253,128,128,128,128,254,128,128,128,128,255,0,128,128,128,255,
+0,128,128,128,254,128,128,128,128,253,128,128,128,128,128,255,0,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,0,0,0,0,20,0,0,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,19,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,5,
+53,51,21,51,53,51,21,7,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,128,128,1,128,128,253,0,128,128,128,128,128,253,128,128,128,128,128,128,254,0,128,128,128,128,128,128,128,254,0,128,
+128,128,128,128,253,128,128,128,128,128,128,253,0,128,1,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,0,0,0,0,20,0,128,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,1,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,33,53,51,21,5,53,
+51,21,33,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,51,53,51,21,1,0,128,128,254,128,128,1,0,128,254,0,128,1,0,128,254,128,128,128,1,0,128,253,0,128,1,0,128,128,128,253,0,128,1,128,128,253,128,
+128,1,128,128,254,0,128,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,3,1,128,3,0,
+2,0,4,128,0,3,0,7,0,11,0,0,1,53,51,21,7,53,51,21,7,53,51,21,1,128,128,128,128,128,128,4,0,128,128,128,128,128,128,128,128,0,0,11,1,0,255,0,2,128,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,0,1,53,51,21,5,53,51,21,7,53,51,21,5,53,51,21,
+7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,29,1,53,51,21,7,53,51,29,1,53,51,21,2,0,128,255,0,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,0,0,11,1,0,255,0,2,128,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,0,1,53,51,29,1,53,51,21,7,53,51,29,1,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,7,53,51,21,5,53,51,21,1,0,
+128,128,128,128,128,128,128,128,128,128,128,128,128,255,0,128,128,128,255,0,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,11,0,128,0,128,3,0,3,0,0,3,0,7,0,11,
+0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,0,1,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,1,128,128,254,128,128,128,128,128,128,254,0,128,128,128,254,0,128,128,128,128,128,
+254,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,9,0,128,0,128,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,0,1,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,
+49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,1,128,128,128,128,254,128,128,128,128,128,128,254,128,128,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,4,0,128,255,0,1,128,1,0,0,3,0,7,0,11,0,15,
+0,0,37,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,1,0,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,5,0,128,1,128,3,0,2,0,0,3,0,7,0,11,0,15,0,19,0,0,19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,128,
+128,128,128,128,128,1,128,128,128,128,128,128,128,128,128,128,128,0,2,1,0,0,0,1,128,1,0,0,3,0,7,0,0,37,53,51,21,7,53,51,21,1,0,128,128,128,128,128,128,128,128,128,0,0,10,0,128,255,128,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,0,1,53,
+51,21,7,53,51,21,5,53,51,21,7,53,51,21,5,53,51,21,7,53,51,21,5,53,51,21,7,53,51,21,5,53,51,21,7,53,51,21,2,128,128,128,128,255,0,128,128,128,255,0,128,128,128,255,0,128,128,128,255,0,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,20,0,128,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,
+51,21,33,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,128,128,128,
+128,253,128,128,128,128,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,0,0,0,0,14,0,128,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,0,1,53,51,21,5,53,51,21,49,53,51,21,5,53,51,21,51,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,49,
+53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,128,128,255,0,128,128,254,128,128,128,128,128,128,128,128,128,128,128,128,254,128,128,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,0,15,0,128,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,7,53,51,21,5,53,51,21,5,53,51,21,5,53,51,21,5,53,
+51,21,7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,254,0,128,1,128,128,128,128,255,0,128,255,0,128,255,0,128,255,0,128,128,128,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,15,0,128,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,7,53,51,21,5,53,
+51,21,49,53,51,29,1,53,51,21,7,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,254,0,128,1,128,128,128,128,254,128,128,128,128,128,128,253,128,128,1,128,128,254,0,128,128,128,3,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,17,0,128,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,0,1,53,51,21,5,53,51,21,49,53,
+51,21,5,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,2,128,128,255,0,128,128,254,128,128,128,128,254,0,128,1,0,128,253,128,128,1,128,128,
+253,128,128,128,128,128,128,128,255,0,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,18,0,128,0,0,3,0,4,0,0,3,
+0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,29,1,53,51,21,7,53,51,21,5,53,51,21,
+33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,128,253,128,128,128,128,128,128,128,128,128,128,128,128,253,128,128,1,128,128,254,0,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,17,0,128,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,0,1,53,51,21,49,53,51,21,5,53,51,21,5,53,51,21,7,53,
+51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,128,128,128,254,128,128,255,0,128,128,128,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,
+128,1,128,128,254,0,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,12,0,128,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,
+0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,0,19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,7,53,51,21,5,53,51,21,7,53,51,21,5,53,51,21,7,53,51,21,5,53,51,21,7,53,51,21,128,128,128,128,128,128,128,128,255,0,128,128,128,255,0,128,128,128,255,0,
+128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,19,0,128,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,
+71,0,75,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,254,
+0,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,17,0,128,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,
+21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,7,53,51,21,5,53,51,21,5,53,51,21,49,53,51,21,1,0,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,128,128,255,0,128,
+254,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,4,1,128,0,0,2,0,3,0,0,3,0,7,0,11,0,15,0,0,1,53,51,21,7,53,51,
+21,3,53,51,21,7,53,51,21,1,128,128,128,128,128,128,128,128,2,128,128,128,128,128,128,254,128,128,128,128,128,128,0,0,6,0,128,255,0,1,128,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,0,1,53,51,21,7,53,51,21,3,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,1,0,128,128,
+128,128,128,128,128,128,128,255,0,128,2,128,128,128,128,128,128,254,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,10,0,0,0,128,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,0,1,53,51,21,49,53,51,21,5,53,51,21,49,53,51,21,5,53,51,21,
+49,53,51,29,1,53,51,21,49,53,51,29,1,53,51,21,49,53,51,21,2,0,128,128,254,0,128,128,254,0,128,128,128,128,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,12,0,128,1,0,3,128,2,128,0,3,
+0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,0,19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,128,128,253,0,128,128,128,128,
+128,128,2,0,128,128,128,128,128,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,0,0,10,0,128,0,128,3,128,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,0,19,53,51,21,49,53,51,29,1,53,51,21,49,53,51,29,1,53,51,
+21,49,53,51,21,5,53,51,21,49,53,51,21,5,53,51,21,49,53,51,21,128,128,128,128,128,128,128,254,0,128,128,254,0,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,10,0,128,0,0,3,0,4,0,0,
+3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,7,53,51,21,5,53,51,21,5,53,51,21,7,53,51,21,3,53,51,21,1,0,128,128,128,254,0,128,1,128,128,128,128,255,0,128,255,0,128,128,128,128,128,3,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,255,0,128,128,0,26,0,0,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,
+103,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,49,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,49,53,51,21,49,53,51,
+21,5,53,51,29,1,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,254,0,128,1,128,128,253,0,128,1,0,128,128,128,128,252,128,128,128,128,128,128,128,128,252,128,128,128,128,128,128,128,128,252,128,128,1,0,128,128,128,253,128,128,128,128,128,
+128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,
+0,18,0,128,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,53,51,21,49,53,51,21,5,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,
+51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,1,128,128,128,255,0,128,128,254,128,128,1,0,128,254,0,128,1,0,128,254,0,128,128,128,128,253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,3,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,24,0,128,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,
+63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,0,19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,
+51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,128,128,128,128,253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,128,128,128,128,3,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,14,0,128,0,0,3,128,4,
+0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,7,53,51,29,1,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,128,128,128,128,
+254,0,128,1,128,128,253,0,128,128,128,128,128,128,128,128,1,128,128,254,0,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,20,0,128,0,0,
+3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,
+5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,254,0,128,1,128,128,253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,1,128,128,253,128,128,128,128,128,
+3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,19,0,128,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,
+0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,0,19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,49,53,51,21,49,
+53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,128,253,128,128,128,128,128,128,128,128,128,254,0,128,128,128,128,128,128,128,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,15,0,128,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,0,19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,
+21,7,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,128,128,128,128,128,128,253,128,128,128,128,128,128,128,128,128,254,0,128,128,128,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,18,0,128,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,53,51,21,49,53,51,21,49,
+53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,33,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,128,128,128,128,254,0,128,1,128,128,253,0,128,128,128,128,128,1,0,
+128,128,128,253,0,128,2,0,128,253,128,128,1,128,128,254,0,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,
+0,0,0,20,0,128,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,19,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,
+53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,128,128,128,128,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,
+0,128,2,0,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,12,1,0,0,0,2,128,4,0,0,3,0,7,0,11,0,
+15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,255,
+0,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,12,0,128,0,0,2,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,0,1,53,51,21,49,53,51,
+21,49,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,254,0,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,17,0,128,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,0,19,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,
+53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,128,128,2,0,128,253,0,128,1,128,128,253,128,128,1,0,128,254,0,128,128,128,254,128,128,128,128,254,128,128,1,0,128,
+254,0,128,1,128,128,253,128,128,2,0,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,12,0,128,0,0,3,0,4,0,0,3,0,7,0,11,
+0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,0,19,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,26,0,0,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,
+63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,103,0,0,17,53,51,21,49,53,51,21,33,53,51,21,49,53,51,21,5,53,51,21,49,53,51,21,33,53,51,21,49,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,51,53,51,21,5,53,
+51,21,33,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,128,128,1,128,128,128,252,128,128,128,1,128,128,128,252,128,128,128,128,128,128,128,128,252,128,128,128,128,128,128,128,128,252,128,128,1,0,
+128,1,0,128,252,128,128,1,0,128,1,0,128,252,128,128,2,128,128,252,128,128,2,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,24,0,128,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,0,19,53,51,21,49,53,51,21,33,
+53,51,21,5,53,51,21,49,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,49,53,51,
+21,128,128,128,1,128,128,253,0,128,128,1,128,128,253,0,128,128,128,1,0,128,253,0,128,128,128,1,0,128,253,0,128,1,0,128,128,128,253,0,128,1,0,128,128,128,253,0,128,1,128,128,128,253,0,128,1,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,16,0,128,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,
+43,0,47,0,51,0,55,0,59,0,63,0,0,1,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,1,128,128,128,254,128,128,1,0,128,
+253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,128,128,1,0,128,254,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,0,0,0,0,17,0,128,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,0,19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,
+21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,128,128,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,128,128,128,254,0,128,128,128,128,128,3,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,18,0,128,255,128,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,
+67,0,71,0,0,1,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,51,53,51,21,7,53,51,21,1,128,128,128,254,128,128,1,0,128,
+253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,128,128,1,0,128,254,128,128,128,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,20,0,128,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,
+51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,128,128,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,
+253,128,128,128,128,128,254,0,128,1,0,128,254,0,128,1,128,128,253,128,128,2,0,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,0,18,0,128,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,29,1,53,51,21,49,53,51,29,1,53,
+51,21,49,53,51,29,1,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,128,253,128,128,2,0,128,253,0,128,128,128,128,128,128,253,0,128,2,0,128,253,128,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,14,0,0,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,0,17,53,51,21,49,
+53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,128,128,128,128,128,128,128,254,0,128,128,128,128,128,128,128,128,128,128,128,128,128,3,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,18,0,128,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,19,
+53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,128,128,2,0,128,253,0,128,2,0,128,253,0,128,
+2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,128,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,0,14,0,0,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,0,17,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,5,53,51,
+21,51,53,51,21,5,53,51,21,7,53,51,21,128,2,128,128,252,128,128,2,128,128,253,0,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,254,128,128,128,128,255,0,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,24,0,0,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,0,17,53,51,21,33,53,51,21,5,53,51,21,33,
+53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,49,53,51,21,51,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,128,2,128,
+128,252,128,128,1,0,128,1,0,128,252,128,128,1,0,128,1,0,128,252,128,128,128,128,128,128,128,128,252,128,128,128,128,128,128,128,128,253,0,128,128,128,128,128,253,128,128,1,128,128,253,128,128,1,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,16,0,128,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,
+43,0,47,0,51,0,55,0,59,0,63,0,0,19,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,5,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,128,128,2,0,128,253,0,128,2,0,128,
+253,128,128,1,0,128,254,128,128,128,255,0,128,128,254,128,128,1,0,128,253,128,128,2,0,128,253,0,128,2,0,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,0,12,0,0,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,0,17,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,128,2,128,
+128,252,128,128,2,128,128,253,0,128,1,128,128,254,0,128,128,128,255,0,128,128,128,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,18,0,128,0,0,3,128,
+4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,7,53,51,21,5,53,51,21,5,53,51,21,5,53,51,21,5,53,51,21,5,53,51,21,7,53,51,21,49,53,
+51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,128,128,128,128,255,0,128,255,0,128,255,0,128,255,0,128,255,0,128,128,128,128,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,15,1,0,255,0,2,128,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,
+51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,254,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,4,0,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,10,0,128,255,128,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,0,19,53,51,21,7,53,51,29,1,53,51,
+21,7,53,51,29,1,53,51,21,7,53,51,29,1,53,51,21,7,53,51,29,1,53,51,21,7,53,51,21,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,0,0,15,1,0,255,0,2,128,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,0,1,53,51,21,49,53,51,21,49,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,
+5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,254,128,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,10,0,128,1,128,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,0,1,53,51,21,7,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,1,
+128,128,128,128,255,0,128,128,128,254,128,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,7,0,0,255,128,3,128,0,0,0,3,0,7,0,11,0,15,0,
+19,0,23,0,27,0,0,21,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,2,1,0,3,128,2,0,4,128,0,3,0,7,0,0,1,53,51,29,1,53,51,21,1,0,
+128,128,4,0,128,128,128,128,128,0,0,16,0,128,0,0,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,0,1,53,51,21,49,53,51,21,49,53,51,29,1,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,
+21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,128,254,0,128,128,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,19,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,0,19,53,51,21,7,53,51,21,7,53,51,21,7,53,
+51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,128,128,128,128,128,128,254,0,128,1,128,128,253,128,
+128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,0,0,12,0,128,0,0,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,
+128,128,254,0,128,1,128,128,253,128,128,128,128,128,128,1,128,128,254,0,128,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,19,0,128,0,0,3,0,4,128,0,3,0,7,0,11,
+0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,0,1,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,
+51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,2,128,128,128,128,128,128,254,0,128,128,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,4,0,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,16,0,128,0,0,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,
+0,63,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,254,0,128,1,128,128,253,128,128,128,128,
+128,128,253,128,128,128,128,1,128,128,254,0,128,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,14,0,128,0,0,3,0,4,128,0,3,0,7,0,11,
+0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,1,128,128,128,128,254,0,128,128,
+128,255,0,128,128,128,128,254,128,128,128,128,128,128,128,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,21,0,128,254,128,3,0,3,0,
+0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,0,1,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,
+51,21,49,53,51,21,49,53,51,21,49,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,128,128,128,128,254,0,
+128,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,17,0,128,0,0,3,0,4,128,0,3,0,
+7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,0,19,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,
+21,5,53,51,21,33,53,51,21,128,128,128,128,128,128,128,128,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,8,1,0,0,0,2,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,0,1,53,51,21,1,53,51,21,49,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,
+21,1,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,4,0,128,128,254,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,12,0,128,255,0,2,128,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,
+47,0,0,1,53,51,21,1,53,51,21,49,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,2,0,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,254,0,128,128,128,4,0,128,128,254,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,16,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,0,19,53,51,21,7,53,51,21,7,
+53,51,21,7,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,128,128,128,128,128,128,128,128,1,128,128,253,128,128,1,0,128,254,0,128,128,128,254,128,128,
+128,128,254,128,128,1,0,128,254,0,128,1,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,10,1,0,0,0,2,0,4,128,0,3,0,7,0,
+11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,0,1,53,51,21,49,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,1,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,4,0,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,20,0,0,0,0,3,128,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,17,53,51,21,49,53,51,21,49,53,
+51,21,51,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,33,53,51,21,128,128,128,128,128,128,253,0,128,1,0,128,1,0,
+128,252,128,128,1,0,128,1,0,128,252,128,128,1,0,128,1,0,128,252,128,128,1,0,128,1,0,128,252,128,128,1,0,128,1,0,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,14,0,128,0,0,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,0,19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,
+51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,128,128,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,14,0,128,0,0,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,
+53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,2,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,19,0,128,254,128,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,0,19,53,51,21,49,53,51,21,
+49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,128,128,128,128,128,254,0,128,1,128,128,253,128,128,1,
+128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,128,128,128,254,0,128,128,128,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,0,19,0,128,254,128,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,0,1,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,
+51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,1,0,128,128,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,
+128,128,128,128,128,128,128,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,10,0,128,0,0,3,0,3,0,0,
+3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,0,19,53,51,21,51,53,51,21,49,53,51,21,5,53,51,21,49,53,51,21,33,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,128,128,128,128,128,254,0,128,128,1,0,128,253,128,128,128,128,128,128,128,128,2,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,13,0,128,0,0,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,0,1,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,29,1,53,51,
+21,49,53,51,29,1,53,51,29,1,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,128,253,128,128,128,128,128,128,253,128,128,128,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,0,0,0,13,1,0,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,0,1,53,51,21,7,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,7,53,51,29,1,53,51,21,
+49,53,51,21,49,53,51,21,1,0,128,128,128,128,128,128,128,128,254,0,128,128,128,128,128,128,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,14,
+0,128,0,0,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,0,19,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,
+21,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,0,0,0,10,0,128,0,0,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,0,19,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,7,53,51,21,128,128,1,128,128,253,128,128,1,128,128,
+254,0,128,128,128,254,128,128,128,128,255,0,128,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,18,0,0,0,0,3,128,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,
+51,0,55,0,59,0,63,0,67,0,71,0,0,17,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,49,53,51,21,51,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,128,2,128,
+128,252,128,128,1,0,128,1,0,128,252,128,128,1,0,128,1,0,128,252,128,128,128,128,128,128,128,128,253,0,128,128,128,128,128,253,128,128,1,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,10,0,128,0,0,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,0,19,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,7,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,33,53,
+51,21,128,128,1,128,128,254,0,128,128,128,255,0,128,128,128,255,0,128,128,128,254,0,128,1,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,19,0,128,254,128,3,0,3,0,0,3,0,7,0,11,
+0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,0,19,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,7,53,
+51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,128,128,128,128,254,0,128,128,128,2,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,14,0,128,0,0,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,0,
+19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,7,53,51,21,5,53,51,21,5,53,51,21,5,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,128,128,128,255,0,128,255,0,128,255,0,128,255,0,128,128,128,128,128,
+2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,14,0,128,255,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,0,1,53,51,21,
+49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,49,53,51,29,1,53,51,21,7,53,51,21,7,53,51,21,7,53,51,29,1,53,51,21,49,53,51,21,2,0,128,128,254,128,128,128,128,128,128,128,128,254,128,128,128,128,128,128,128,128,128,128,128,128,4,0,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,11,1,128,255,0,2,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,0,1,53,51,21,
+7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,1,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,14,0,128,255,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,0,19,53,51,21,49,53,51,29,1,53,51,21,7,53,51,21,7,53,51,21,7,53,51,29,1,
+53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,128,128,128,128,128,128,128,128,128,128,128,128,254,128,128,128,128,128,128,128,128,254,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,8,0,0,1,128,3,128,2,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,0,19,53,51,21,49,53,51,21,49,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,49,53,51,21,49,
+53,51,21,128,128,128,128,1,0,128,252,128,128,1,0,128,128,128,2,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,19,0,128,0,0,3,128,3,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,
+0,75,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,128,128,128,128,254,
+0,128,1,128,128,253,0,128,128,128,128,254,128,128,255,0,128,128,128,128,254,128,128,1,128,128,254,0,128,128,128,3,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,0,0,0,0,4,1,0,255,0,2,0,1,0,0,3,0,7,0,11,0,15,0,0,37,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,1,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,16,0,128,255,0,3,0,4,128,
+0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,0,1,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,
+49,53,51,21,2,0,128,128,254,128,128,128,128,255,0,128,128,128,128,254,128,128,128,128,128,128,128,128,128,128,128,128,254,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,6,1,0,255,128,2,128,1,0,0,3,0,7,0,11,0,15,0,19,0,23,0,0,37,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,1,0,128,128,128,254,128,128,128,128,254,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,3,0,128,0,0,3,0,0,128,0,3,0,7,0,11,0,0,51,53,51,21,51,53,51,21,51,53,51,21,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,13,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,
+39,0,43,0,47,0,51,0,0,1,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,1,128,128,128,128,254,128,128,128,128,128,128,254,128,128,128,128,128,128,128,128,
+128,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,17,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,
+0,59,0,63,0,67,0,0,1,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,1,128,128,128,128,254,128,128,128,128,
+128,128,254,128,128,254,128,128,128,128,128,128,254,128,128,128,128,128,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,0,0,0,0,5,0,128,3,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,0,1,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,1,128,128,255,0,128,128,128,254,0,128,1,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,14,0,128,0,0,3,128,4,0,0,3,
+0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,0,1,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,7,53,51,21,5,53,51,21,7,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,51,53,51,21,5,53,51,21,2,0,128,254,0,128,1,0,
+128,254,0,128,128,128,128,128,255,0,128,128,128,128,128,128,128,253,0,128,1,0,128,128,128,253,0,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,
+0,0,21,0,128,0,0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,0,1,53,51,21,51,53,51,21,5,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,29,1,
+53,51,21,49,53,51,29,1,53,51,21,49,53,51,29,1,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,255,0,128,255,0,128,128,128,128,253,128,128,2,0,128,253,0,128,128,128,128,128,128,253,0,128,2,0,128,253,128,128,
+128,128,128,4,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,5,0,128,0,128,2,0,3,0,0,
+3,0,7,0,11,0,15,0,19,0,0,1,53,51,21,5,53,51,21,5,53,51,29,1,53,51,29,1,53,51,21,1,128,128,255,0,128,255,0,128,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,24,0,0,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,
+0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,0,19,53,51,21,49,53,51,21,51,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,
+21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,51,53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,128,128,252,128,128,1,0,128,254,0,128,1,0,128,254,0,128,1,0,128,128,128,253,0,128,1,0,128,254,0,128,1,0,128,254,0,128,1,0,
+128,254,128,128,128,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,0,0,0,21,0,128,0,0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,0,1,53,51,21,51,53,51,21,5,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,
+21,7,53,51,21,5,53,51,21,5,53,51,21,5,53,51,21,5,53,51,21,5,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,255,0,128,254,128,128,128,128,128,128,128,128,128,255,0,128,255,0,128,255,0,128,255,0,128,255,
+0,128,128,128,128,128,128,128,128,4,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,3,
+1,128,3,0,2,128,4,128,0,3,0,7,0,11,0,0,1,53,51,21,7,53,51,29,1,53,51,21,1,128,128,128,128,128,4,0,128,128,128,128,128,128,128,128,0,0,0,3,1,0,3,0,2,0,4,128,0,3,0,7,0,11,0,0,1,53,51,21,7,53,51,21,5,53,51,21,1,128,128,128,128,255,0,128,4,0,128,128,128,
+128,128,128,128,128,0,6,1,0,3,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,0,1,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,1,0,128,128,128,254,128,128,128,128,255,0,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,0,0,6,0,128,3,0,2,128,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,0,1,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,1,0,128,128,128,254,128,128,128,128,254,0,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,
+13,0,128,0,128,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,0,1,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,1,128,128,
+255,0,128,128,128,254,0,128,128,128,128,128,254,0,128,128,128,255,0,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,5,0,128,1,128,3,0,2,0,0,3,0,7,0,11,0,15,0,19,
+0,0,19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,128,1,128,128,128,128,128,128,128,128,128,128,128,0,7,0,0,1,128,3,128,2,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,0,17,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,
+21,49,53,51,21,49,53,51,21,128,128,128,128,128,128,128,1,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,4,0,128,3,0,2,128,4,0,0,3,0,7,0,11,0,15,0,0,1,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,1,0,128,128,128,254,0,128,128,128,3,
+128,128,128,128,128,128,128,128,128,128,0,0,0,0,16,0,0,2,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,0,17,53,51,21,49,53,51,21,49,53,51,21,51,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,49,53,
+51,21,49,53,51,21,5,53,51,21,33,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,51,53,51,21,128,128,128,128,128,128,128,253,0,128,1,0,128,128,128,253,0,128,1,0,128,128,128,253,0,128,1,0,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,16,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,0,1,53,51,21,51,53,51,21,5,53,51,21,1,53,51,21,49,53,51,21,
+49,53,51,21,49,53,51,21,5,53,51,29,1,53,51,21,49,53,51,29,1,53,51,29,1,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,255,0,128,255,0,128,128,128,128,253,128,128,128,128,128,128,253,128,128,128,128,128,4,0,128,128,128,128,128,
+128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,5,0,128,0,128,2,0,3,0,0,3,0,7,0,11,0,15,0,19,0,0,19,53,51,29,1,53,51,29,1,53,51,21,5,53,51,21,5,53,51,21,
+128,128,128,128,255,0,128,255,0,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,21,0,0,0,0,3,128,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,0,19,53,51,21,49,53,51,21,
+51,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,51,53,51,21,49,53,51,21,128,128,128,128,128,128,253,
+0,128,1,0,128,1,0,128,252,128,128,1,0,128,128,128,128,252,128,128,1,0,128,254,0,128,1,0,128,1,0,128,253,0,128,128,128,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,17,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,0,1,53,51,21,51,53,51,21,5,53,51,21,1,53,51,21,49,53,51,21,49,53,51,
+21,49,53,51,21,49,53,51,21,7,53,51,21,5,53,51,21,5,53,51,21,5,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,255,0,128,254,128,128,128,128,128,128,128,128,255,0,128,255,0,128,255,0,128,255,0,128,128,128,128,128,4,
+0,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,13,0,0,0,0,3,128,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,
+47,0,51,0,0,1,53,51,21,51,53,51,21,1,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,1,0,128,128,128,253,128,128,2,128,128,252,128,128,2,128,128,253,0,128,1,128,128,254,0,128,
+128,128,255,0,128,128,128,128,128,4,0,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,7,1,128,0,0,2,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,0,1,53,51,21,3,
+53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,1,128,128,128,128,128,128,128,128,128,128,128,128,128,128,3,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,18,0,128,255,128,3,0,3,128,0,3,0,7,0,11,
+0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,
+49,53,51,21,49,53,51,21,5,53,51,21,1,128,128,255,0,128,128,128,254,0,128,128,128,128,128,253,128,128,128,128,254,128,128,128,128,254,128,128,128,128,128,128,254,0,128,128,128,255,0,128,3,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,16,0,128,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,0,1,53,51,21,49,53,51,21,5,53,51,
+21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,5,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,128,128,128,254,128,128,128,128,255,0,128,128,128,128,254,128,128,128,128,255,0,128,128,128,128,
+128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,20,0,0,0,0,3,128,3,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,
+0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,17,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,
+21,49,53,51,21,5,53,51,21,33,53,51,21,128,2,128,128,253,0,128,128,128,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,128,128,128,128,253,0,128,2,128,128,3,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,16,0,0,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,0,17,53,51,21,33,
+53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,128,2,128,128,252,128,128,2,128,128,253,0,128,1,128,128,254,0,128,128,128,255,0,
+128,254,128,128,128,128,128,128,254,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,10,1,128,255,0,2,0,4,128,0,3,
+0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,0,1,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,3,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,1,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,4,0,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,18,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,53,51,21,49,53,
+51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,29,1,53,51,21,49,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,49,53,51,29,1,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,254,0,128,1,128,128,253,128,128,128,128,255,
+0,128,128,128,255,0,128,128,128,253,128,128,1,128,128,254,0,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+0,0,2,1,0,4,0,2,128,4,128,0,3,0,7,0,0,1,53,51,21,51,53,51,21,1,0,128,128,128,4,0,128,128,128,128,0,0,28,0,0,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,103,
+0,107,0,111,0,0,19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,49,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,49,53,51,21,
+51,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,128,253,0,128,2,128,128,252,128,128,1,0,128,128,128,128,252,128,128,128,128,1,128,128,252,128,128,128,128,1,128,128,252,128,128,1,0,128,
+128,128,128,252,128,128,2,128,128,253,0,128,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,11,0,128,1,128,2,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,0,1,53,51,21,49,53,51,29,1,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,
+21,49,53,51,21,49,53,51,21,1,0,128,128,128,254,128,128,128,128,254,0,128,1,0,128,254,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,10,0,128,0,128,3,0,3,0,0,3,0,7,0,11,
+0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,0,1,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,1,128,128,128,128,254,0,128,128,128,254,0,128,128,128,255,0,128,128,128,255,0,128,128,128,2,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,7,0,128,0,0,2,128,2,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,0,19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,128,128,128,
+128,128,128,128,128,128,128,128,1,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,30,0,0,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,
+0,103,0,107,0,111,0,115,0,119,0,0,19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,49,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,49,53,51,21,33,53,
+51,21,5,53,51,21,51,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,128,253,0,128,2,128,128,252,128,128,128,128,128,1,0,128,252,128,128,128,128,128,128,128,128,252,
+128,128,128,128,128,1,0,128,252,128,128,128,128,128,128,128,128,252,128,128,2,128,128,253,0,128,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,7,0,0,4,128,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,0,17,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,
+53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,128,128,4,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,8,0,128,2,128,2,128,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,0,1,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,
+51,21,33,53,51,21,5,53,51,21,49,53,51,21,1,0,128,128,254,128,128,1,0,128,254,0,128,1,0,128,254,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,14,0,128,0,0,3,0,3,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,
+0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,0,1,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,128,128,128,128,254,128,128,128,128,128,128,254,
+128,128,128,128,254,128,128,128,128,128,128,3,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,0,10,0,128,2,0,2,128,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,
+0,39,0,0,19,53,51,21,49,53,51,21,49,53,51,29,1,53,51,21,5,53,51,21,5,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,255,0,128,255,0,128,255,0,128,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,0,0,10,0,128,2,0,2,128,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,0,19,53,51,21,49,53,51,21,49,53,51,29,1,53,51,21,5,53,51,21,49,53,51,29,1,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,
+254,128,128,128,128,254,0,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,2,1,128,3,128,2,128,4,128,0,3,0,7,0,0,1,53,51,21,5,53,51,21,2,0,128,255,0,128,4,0,128,128,128,128,128,0,
+0,0,0,17,0,0,255,0,3,128,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,0,19,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,33,53,51,21,5,53,51,
+21,51,53,51,21,49,53,51,21,51,53,51,21,5,53,51,21,5,53,51,21,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,128,1,0,128,253,128,128,128,128,128,128,128,253,0,128,255,0,128,2,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,26,0,128,255,128,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,
+63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,103,0,0,1,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,51,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,51,53,51,21,5,53,51,21,49,53,51,21,51,53,51,21,5,53,
+51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,1,0,128,128,128,128,128,253,0,128,128,128,128,128,253,128,128,128,128,128,128,254,0,128,128,128,128,254,128,128,128,128,254,128,128,128,128,
+254,128,128,128,128,254,128,128,128,128,254,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,9,1,0,1,0,2,128,2,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,
+254,128,128,128,128,254,128,128,128,128,2,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,4,1,128,254,128,2,128,0,0,0,3,0,7,0,11,0,15,0,0,5,53,51,21,49,53,51,21,7,53,51,21,5,53,51,21,1,128,128,128,128,128,255,0,128,
+128,128,128,128,128,128,128,128,128,128,128,0,8,0,128,2,0,2,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,0,1,53,51,21,5,53,51,21,49,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,255,0,128,128,128,128,128,128,255,0,128,128,
+128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,10,0,128,2,0,2,128,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,0,1,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,
+33,53,51,21,5,53,51,21,49,53,51,21,1,0,128,128,254,128,128,1,0,128,254,0,128,1,0,128,254,0,128,1,0,128,254,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,10,0,128,0,128,3,0,3,0,0,3,0,
+7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,0,19,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,128,128,128,128,255,0,128,128,128,255,0,128,128,128,254,0,128,128,128,254,0,128,128,128,
+2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,22,0,128,0,0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,0,1,53,51,
+21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,7,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,49,53,51,21,5,53,51,21,51,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,2,128,
+128,253,128,128,1,128,128,253,128,128,1,0,128,254,0,128,1,0,128,254,0,128,128,128,128,128,255,0,128,1,0,128,254,0,128,128,128,128,253,128,128,128,128,128,128,128,253,0,128,1,128,128,4,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,22,0,128,0,0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,
+0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,0,1,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,
+51,21,33,53,51,21,49,53,51,21,49,53,51,21,2,128,128,253,128,128,1,128,128,253,128,128,1,0,128,254,0,128,1,0,128,254,0,128,128,128,128,128,128,128,254,0,128,1,128,128,253,128,128,1,0,128,253,128,128,1,0,128,254,0,128,1,0,128,128,128,4,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,26,0,0,0,0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,
+23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,103,0,0,1,53,51,21,5,53,51,21,49,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,49,53,51,21,51,53,51,21,5,53,51,21,49,53,51,21,5,53,51,21,49,53,
+51,21,51,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,49,53,51,21,5,53,51,21,51,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,2,128,128,253,0,128,128,1,128,128,254,0,128,128,128,254,0,128,128,128,128,254,128,128,128,254,
+0,128,128,128,128,255,0,128,1,0,128,254,0,128,128,128,128,253,128,128,128,128,128,128,128,253,0,128,1,128,128,4,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,10,0,128,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,0,1,53,51,21,3,53,51,21,7,53,51,21,5,53,51,21,5,53,51,21,7,53,51,21,33,
+53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,128,128,128,128,128,128,255,0,128,255,0,128,128,128,1,128,128,254,0,128,128,128,3,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,18,0,128,0,
+0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,53,51,29,1,53,51,21,1,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,
+21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,1,128,128,128,255,0,128,128,254,128,128,1,0,128,254,0,128,1,0,128,254,0,128,128,128,128,253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,4,128,128,128,128,128,128,255,0,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,18,0,128,0,0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,
+0,0,1,53,51,21,5,53,51,21,3,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,2,0,128,255,0,128,128,128,128,254,128,128,
+1,0,128,254,0,128,1,0,128,254,0,128,128,128,128,253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,4,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,0,20,0,128,0,0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,1,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,1,53,51,21,49,53,51,21,5,53,51,21,33,53,51,
+21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,1,128,128,128,254,128,128,1,0,128,254,128,128,128,254,128,128,1,0,128,254,0,128,1,0,128,254,0,128,128,128,128,
+253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,4,128,128,128,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,0,0,0,0,20,0,128,0,0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,1,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,1,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,
+5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,1,128,128,128,128,254,0,128,128,128,255,0,128,128,254,128,128,1,0,128,254,0,128,1,0,128,254,0,128,128,128,128,253,128,128,2,0,128,253,
+0,128,2,0,128,253,0,128,2,0,128,4,128,128,128,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,18,0,128,0,
+0,3,128,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,53,51,21,33,53,51,21,1,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,
+51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,1,0,128,1,0,128,254,128,128,128,254,128,128,1,0,128,254,0,128,1,0,128,254,0,128,128,128,128,253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,4,0,128,128,128,128,255,0,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,22,0,128,0,0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,
+71,0,75,0,79,0,83,0,87,0,0,1,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,
+51,21,5,53,51,21,33,53,51,21,1,128,128,128,254,128,128,1,0,128,254,0,128,1,0,128,254,128,128,128,254,128,128,1,0,128,254,0,128,1,0,128,254,0,128,128,128,128,253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,4,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,23,0,0,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,
+39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,0,1,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,49,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,
+51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,49,53,51,21,49,53,51,21,1,128,128,128,128,128,253,128,128,128,128,254,128,128,128,128,254,0,128,1,0,128,128,253,128,128,128,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,
+1,128,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,17,0,128,
+254,128,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,7,53,51,29,1,53,51,21,33,53,51,21,5,53,51,21,49,53,51,
+21,49,53,51,21,5,53,51,21,7,53,51,21,5,53,51,21,1,128,128,128,128,254,0,128,1,128,128,253,0,128,128,128,128,128,128,128,128,1,128,128,254,0,128,128,128,255,0,128,128,128,255,0,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,20,0,128,0,0,3,0,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,1,53,51,
+29,1,53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,254,128,128,128,
+128,128,128,253,128,128,128,128,128,128,128,128,128,254,0,128,128,128,128,128,128,128,128,128,4,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,0,0,20,0,128,0,0,3,0,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,1,53,51,21,5,53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,
+5,53,51,21,7,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,2,0,128,255,0,128,254,128,128,128,128,128,128,253,128,128,128,128,128,128,128,128,128,254,0,128,128,
+128,128,128,128,128,128,128,4,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,21,0,128,0,0,3,
+0,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,0,1,53,51,21,5,53,51,21,51,53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,49,53,51,21,
+49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,128,128,255,0,128,128,128,254,0,128,128,128,128,128,253,128,128,128,128,128,128,128,128,128,254,0,128,128,128,128,128,128,128,128,128,4,128,128,
+128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,20,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,
+23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,1,53,51,21,51,53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,
+7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,254,0,128,128,128,128,128,253,128,128,128,128,128,128,128,128,128,254,0,128,128,128,128,128,128,128,128,128,4,0,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,13,1,0,0,0,2,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,0,1,53,51,29,1,53,51,21,1,53,51,21,49,
+53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,128,128,128,254,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,255,0,128,128,128,4,128,128,128,128,128,128,255,0,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,13,1,0,0,0,2,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,0,1,53,51,21,5,53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,
+21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,2,0,128,255,0,128,255,0,128,128,128,255,0,128,128,128,128,128,128,128,128,128,255,0,128,128,128,4,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,14,1,0,0,0,2,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,0,1,53,51,21,5,53,51,21,51,53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,
+7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,128,128,255,0,128,128,128,254,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,255,0,128,128,128,4,128,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,13,1,0,0,0,2,128,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,0,1,53,51,21,51,53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,
+53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,254,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,255,0,128,128,128,4,0,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,21,0,0,0,0,3,128,3,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,0,19,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,
+33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,254,0,128,1,128,128,253,128,128,2,0,128,252,
+128,128,128,128,128,1,0,128,253,0,128,2,0,128,253,0,128,1,128,128,253,128,128,128,128,128,3,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,0,25,0,128,0,0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,0,1,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,1,53,51,21,49,53,
+51,21,33,53,51,21,5,53,51,21,51,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,49,53,51,21,1,128,128,128,128,254,
+0,128,128,128,254,0,128,128,1,128,128,253,0,128,128,128,1,0,128,253,0,128,128,128,1,0,128,253,0,128,1,0,128,128,128,253,0,128,1,0,128,128,128,253,0,128,1,128,128,128,253,0,128,1,128,128,128,4,128,128,128,128,128,128,128,128,128,128,255,0,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,16,0,128,0,0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,
+0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,0,1,53,51,29,1,53,51,21,1,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,1,128,128,128,255,0,128,128,
+254,128,128,1,0,128,253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,128,128,1,0,128,254,128,128,128,4,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,0,0,0,0,16,0,128,0,0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,0,1,53,51,21,5,53,51,21,3,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,
+21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,2,0,128,255,0,128,128,128,128,254,128,128,1,0,128,253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,128,128,1,0,128,254,128,128,128,4,128,128,128,128,128,128,255,0,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,18,0,128,0,0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,
+0,1,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,1,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,1,128,128,128,254,128,128,1,0,128,254,128,
+128,128,254,128,128,1,0,128,253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,128,128,1,0,128,254,128,128,128,4,128,128,128,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,18,0,128,0,0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,1,53,51,21,49,53,51,21,5,53,51,21,
+33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,1,128,128,128,128,254,0,128,128,128,255,0,128,128,254,128,128,1,0,128,253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,
+253,128,128,1,0,128,254,128,128,128,4,128,128,128,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,16,0,128,0,0,3,128,4,128,0,
+3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,0,1,53,51,21,33,53,51,21,1,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,
+49,53,51,21,1,0,128,1,0,128,254,128,128,128,254,128,128,1,0,128,253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,128,128,1,0,128,254,128,128,128,4,0,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,9,0,128,0,128,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,0,19,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,128,
+128,1,128,128,254,0,128,128,128,255,0,128,255,0,128,128,128,254,0,128,1,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,22,0,128,0,0,3,128,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,
+0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,0,1,53,51,21,49,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,51,53,51,21,5,53,51,21,33,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,
+33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,49,53,51,21,1,128,128,128,128,128,253,128,128,1,0,128,253,128,128,1,0,128,128,128,253,0,128,1,0,128,128,128,253,0,128,128,128,1,0,128,253,0,128,128,128,1,0,128,253,128,128,1,0,128,253,128,128,
+128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,18,0,128,0,0,3,128,5,
+0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,53,51,29,1,53,51,21,1,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,
+21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,128,128,128,254,0,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,128,128,128,128,128,4,128,128,128,128,128,128,255,0,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,18,0,128,0,0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,
+1,53,51,21,5,53,51,21,1,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,2,0,128,255,0,128,254,128,128,2,0,128,253,0,
+128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,128,128,128,128,128,4,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,0,0,20,0,128,0,0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,1,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,1,53,51,21,33,53,51,21,5,53,51,21,33,
+53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,128,128,128,254,128,128,1,0,128,253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,2,
+0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,128,128,128,128,128,4,128,128,128,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,0,0,18,0,128,0,0,3,128,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,53,51,21,33,53,51,21,1,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,
+5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,0,128,1,0,128,253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,128,128,128,128,128,4,0,128,
+128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,13,0,0,0,0,3,128,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,
+0,47,0,51,0,0,1,53,51,21,5,53,51,21,1,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,7,53,51,21,7,53,51,21,2,0,128,255,0,128,254,0,128,2,128,128,252,128,128,2,128,128,253,0,128,1,128,128,254,0,128,
+128,128,255,0,128,128,128,128,128,4,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,16,0,128,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,
+0,43,0,47,0,51,0,55,0,59,0,63,0,0,19,53,51,21,7,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,128,128,128,128,128,128,128,128,
+128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,128,128,128,254,0,128,128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+0,0,0,0,25,0,0,255,128,3,128,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,
+21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,1,0,128,128,128,254,0,128,1,128,128,253,128,128,1,
+128,128,253,128,128,128,128,128,254,0,128,1,128,128,253,128,128,2,0,128,253,0,128,2,0,128,253,0,128,2,0,128,253,0,128,128,128,128,128,253,0,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,18,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,
+53,51,29,1,53,51,21,1,53,51,21,49,53,51,21,49,53,51,29,1,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,128,128,128,254,128,128,128,128,128,254,0,
+128,128,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,4,0,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,0,18,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,53,51,21,5,53,51,21,1,53,51,21,49,53,51,21,49,53,51,29,1,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,
+33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,2,0,128,255,0,128,255,0,128,128,128,128,254,0,128,128,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,4,0,128,128,128,128,128,255,0,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,19,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,
+71,0,75,0,0,1,53,51,21,5,53,51,21,51,53,51,21,1,53,51,21,49,53,51,21,49,53,51,29,1,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,128,128,255,0,128,
+128,128,254,128,128,128,128,128,254,0,128,128,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,4,0,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,20,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,1,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,1,53,51,21,49,53,51,21,
+49,53,51,29,1,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,128,128,128,128,254,0,128,128,128,254,128,128,128,128,128,254,0,128,128,128,128,253,128,
+128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,4,0,128,128,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+0,0,0,18,0,128,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,53,51,21,51,53,51,21,1,53,51,21,49,53,51,21,49,53,51,29,1,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,
+51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,254,128,128,128,128,128,254,0,128,128,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,3,128,128,128,128,128,255,0,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,20,0,128,0,0,3,0,5,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,
+0,1,53,51,21,5,53,51,21,51,53,51,21,5,53,51,21,1,53,51,21,49,53,51,21,49,53,51,29,1,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,128,128,255,0,128,
+128,128,255,0,128,255,0,128,128,128,128,254,0,128,128,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,4,128,128,128,128,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,22,0,0,0,0,3,128,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,0,19,53,51,21,49,53,51,21,51,53,51,21,49,
+53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,128,128,128,128,128,128,254,128,
+128,1,0,128,253,0,128,128,128,128,128,128,252,128,128,1,0,128,254,0,128,1,0,128,1,0,128,253,0,128,128,128,128,128,2,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,15,0,128,254,128,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,0,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,7,53,51,
+21,7,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,5,53,51,21,1,0,128,128,128,254,0,128,1,128,128,253,128,128,128,128,128,128,1,128,128,254,0,128,128,128,255,0,128,128,128,255,0,128,2,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,18,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,53,51,29,1,
+53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,255,0,128,128,128,254,0,128,1,128,128,253,128,
+128,128,128,128,128,253,128,128,128,128,1,128,128,254,0,128,128,128,4,0,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,
+0,0,18,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,53,51,21,5,53,51,21,3,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,
+51,21,5,53,51,21,7,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,128,128,255,0,128,128,128,128,128,254,0,128,1,128,128,253,128,128,128,128,128,128,253,128,128,128,128,1,128,128,254,0,128,128,128,4,0,128,128,128,128,128,255,0,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,19,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,
+75,0,0,1,53,51,21,5,53,51,21,51,53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,128,128,255,0,128,128,
+128,254,128,128,128,128,254,0,128,1,128,128,253,128,128,128,128,128,128,253,128,128,128,128,1,128,128,254,0,128,128,128,4,0,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,18,0,128,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,53,51,21,51,53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,
+51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,254,128,128,128,128,254,0,128,1,128,128,253,128,128,128,128,128,128,253,128,128,128,128,1,128,128,254,
+0,128,128,128,3,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,9,1,0,0,0,2,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,
+0,31,0,35,0,0,1,53,51,29,1,53,51,21,1,53,51,21,49,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,1,0,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,4,0,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,0,9,1,0,0,0,2,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,0,1,53,51,21,5,53,51,21,3,53,51,21,49,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,1,128,128,255,0,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,4,0,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,10,1,0,0,0,2,128,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,0,1,53,51,21,5,53,51,21,51,53,51,21,1,53,
+51,21,49,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,1,128,128,255,0,128,128,128,254,128,128,128,128,128,128,128,128,128,128,128,128,128,4,0,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,0,9,1,0,0,0,2,128,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,0,1,53,51,21,51,53,51,21,1,53,51,21,49,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,7,53,51,21,1,0,128,128,128,254,128,128,128,128,128,128,128,128,128,128,
+128,128,128,4,0,128,128,128,128,254,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,20,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,1,53,51,
+21,49,53,51,21,51,53,51,21,5,53,51,21,5,53,51,21,51,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,128,255,0,128,
+255,0,128,128,128,128,128,254,0,128,128,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,4,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,18,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,1,53,51,21,
+49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,1,0,128,128,128,254,0,128,128,128,254,128,128,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,
+253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,4,0,128,128,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,16,0,
+128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,0,1,53,51,29,1,53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,
+53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,255,0,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,4,0,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,16,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,0,1,53,51,21,5,53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,
+33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,2,0,128,255,0,128,255,0,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,
+128,4,0,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,17,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,
+47,0,51,0,55,0,59,0,63,0,67,0,0,1,53,51,21,5,53,51,21,51,53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,128,128,255,0,128,128,
+128,254,128,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,4,0,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,0,18,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,0,1,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,5,53,
+51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,128,128,128,128,254,0,128,128,128,254,128,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,
+128,1,128,128,254,0,128,128,128,4,0,128,128,128,128,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,16,0,128,0,0,3,0,4,0,0,3,0,7,0,11,
+0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,0,1,53,51,21,51,53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,
+21,1,0,128,128,128,254,128,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,3,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,0,7,0,128,0,128,3,0,3,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,0,1,53,51,21,1,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,53,51,21,1,128,128,254,128,128,128,128,128,128,254,128,128,2,128,
+128,128,255,0,128,128,128,128,128,128,128,128,128,128,255,0,128,128,0,0,20,0,128,255,128,3,0,3,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,1,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,5,53,
+51,21,33,53,51,21,49,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,51,53,51,21,51,53,51,21,5,53,51,21,49,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,2,128,128,254,0,128,128,128,254,0,128,1,0,128,128,253,128,128,128,128,
+128,128,253,128,128,128,128,128,128,253,128,128,128,1,0,128,254,0,128,128,128,254,0,128,3,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,0,0,0,0,16,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,0,1,53,51,29,1,53,51,21,1,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,
+21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,254,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,4,0,128,128,128,128,128,255,0,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,16,0,128,0,0,3,0,4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,0,1,53,51,21,
+5,53,51,21,1,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,128,128,255,0,128,255,0,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,
+128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,4,0,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,17,0,128,0,0,3,0,
+4,128,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,0,1,53,51,21,5,53,51,21,51,53,51,21,1,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,
+21,49,53,51,21,49,53,51,21,49,53,51,21,1,128,128,255,0,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,4,0,128,128,128,128,128,128,128,255,0,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,16,0,128,0,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,0,1,53,51,21,51,53,51,21,1,
+53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,
+1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,3,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,21,0,128,254,128,3,0,4,128,0,3,
+0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,0,1,53,51,21,5,53,51,21,1,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,
+49,53,51,21,49,53,51,21,49,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,2,0,128,255,0,128,254,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,128,128,
+128,128,254,0,128,128,128,4,0,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,20,0,128,
+255,0,3,0,4,0,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,19,53,51,21,7,53,51,21,7,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,
+21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,49,53,51,21,5,53,51,21,7,53,51,21,128,128,128,128,128,128,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,128,128,128,254,0,128,
+128,128,3,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,21,0,128,254,128,3,0,4,0,0,3,0,7,0,11,
+0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,0,1,53,51,21,51,53,51,21,1,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,33,53,51,21,5,53,51,21,49,53,51,
+21,49,53,51,21,49,53,51,21,7,53,51,21,7,53,51,21,5,53,51,21,49,53,51,21,49,53,51,21,1,0,128,128,128,254,0,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,253,128,128,1,128,128,254,0,128,128,128,128,128,128,128,128,254,
+0,128,128,128,3,128,128,128,128,128,255,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,0,21,1,2,0,0,0,0,
+0,0,0,0,0,36,0,72,0,0,0,0,0,0,0,1,0,26,0,130,0,0,0,0,0,0,0,2,0,14,0,108,0,0,0,0,0,0,0,3,0,26,0,130,0,0,0,0,0,0,0,4,0,26,0,130,0,0,0,0,0,0,0,5,0,20,0,0,0,0,0,0,0,0,0,6,0,26,0,130,0,1,0,0,0,0,0,0,0,18,0,20,0,1,0,0,0,0,0,1,0,13,0,49,0,1,0,0,0,0,0,2,0,7,
+0,38,0,1,0,0,0,0,0,3,0,17,0,45,0,1,0,0,0,0,0,4,0,13,0,49,0,1,0,0,0,0,0,5,0,10,0,62,0,1,0,0,0,0,0,6,0,13,0,49,0,3,0,1,4,9,0,0,0,36,0,72,0,3,0,1,4,9,0,1,0,26,0,130,0,3,0,1,4,9,0,2,0,14,0,108,0,3,0,1,4,9,0,3,0,34,0,122,0,3,0,1,4,9,0,4,0,26,0,130,0,3,0,1,
+4,9,0,5,0,20,0,0,0,3,0,1,4,9,0,6,0,26,0,130,0,50,0,48,0,48,0,52,0,47,0,48,0,52,0,47,0,49,0,53,98,121,32,84,114,105,115,116,97,110,32,71,114,105,109,109,101,114,82,101,103,117,108,97,114,84,84,88,32,80,114,111,103,103,121,67,108,101,97,110,84,84,50,48,
+48,52,47,48,52,47,49,53,0,98,0,121,0,32,0,84,0,114,0,105,0,115,0,116,0,97,0,110,0,32,0,71,0,114,0,105,0,109,0,109,0,101,0,114,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,84,0,84,0,88,0,32,0,80,0,114,0,111,0,103,0,103,0,121,0,67,0,108,0,101,0,97,0,110,0,
+84,0,84,0,0,0,2,0,0,0,0,0,0,0,0,0,20,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,2,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,0,3,0,4,0,5,0,
+6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,0,49,0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,
+57,0,58,0,59,0,60,0,61,0,62,0,63,0,64,0,65,0,66,0,67,0,68,0,69,0,70,0,71,0,72,0,73,0,74,0,75,0,76,0,77,0,78,0,79,0,80,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,0,92,0,93,0,94,0,95,0,96,0,97,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,
+42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,0,172,0,163,0,132,0,133,0,189,0,150,0,232,0,134,0,142,0,139,0,157,0,169,0,164,0,239,0,138,0,218,0,131,0,147,0,242,0,243,0,141,0,151,
+0,136,0,195,0,222,0,241,0,158,0,170,0,245,0,244,0,246,0,162,0,173,0,201,0,199,0,174,0,98,0,99,0,144,0,100,0,203,0,101,0,200,0,202,0,207,0,204,0,205,0,206,0,233,0,102,0,211,0,208,0,209,0,175,0,103,0,240,0,145,0,214,0,212,0,213,0,104,0,235,0,237,0,137,
+0,106,0,105,0,107,0,109,0,108,0,110,0,160,0,111,0,113,0,112,0,114,0,115,0,117,0,116,0,118,0,119,0,234,0,120,0,122,0,121,0,123,0,125,0,124,0,184,0,161,0,127,0,126,0,128,0,129,0,236,0,238,0,186,14,117,110,105,99,111,100,101,35,48,120,48,48,48,49,14,117,
+110,105,99,111,100,101,35,48,120,48,48,48,50,14,117,110,105,99,111,100,101,35,48,120,48,48,48,51,14,117,110,105,99,111,100,101,35,48,120,48,48,48,52,14,117,110,105,99,111,100,101,35,48,120,48,48,48,53,14,117,110,105,99,111,100,101,35,48,120,48,48,48,
+54,14,117,110,105,99,111,100,101,35,48,120,48,48,48,55,14,117,110,105,99,111,100,101,35,48,120,48,48,48,56,14,117,110,105,99,111,100,101,35,48,120,48,48,48,57,14,117,110,105,99,111,100,101,35,48,120,48,48,48,97,14,117,110,105,99,111,100,101,35,48,120,
+48,48,48,98,14,117,110,105,99,111,100,101,35,48,120,48,48,48,99,14,117,110,105,99,111,100,101,35,48,120,48,48,48,100,14,117,110,105,99,111,100,101,35,48,120,48,48,48,101,14,117,110,105,99,111,100,101,35,48,120,48,48,48,102,14,117,110,105,99,111,100,101,
+35,48,120,48,48,49,48,14,117,110,105,99,111,100,101,35,48,120,48,48,49,49,14,117,110,105,99,111,100,101,35,48,120,48,48,49,50,14,117,110,105,99,111,100,101,35,48,120,48,48,49,51,14,117,110,105,99,111,100,101,35,48,120,48,48,49,52,14,117,110,105,99,111,
+100,101,35,48,120,48,48,49,53,14,117,110,105,99,111,100,101,35,48,120,48,48,49,54,14,117,110,105,99,111,100,101,35,48,120,48,48,49,55,14,117,110,105,99,111,100,101,35,48,120,48,48,49,56,14,117,110,105,99,111,100,101,35,48,120,48,48,49,57,14,117,110,105,
+99,111,100,101,35,48,120,48,48,49,97,14,117,110,105,99,111,100,101,35,48,120,48,48,49,98,14,117,110,105,99,111,100,101,35,48,120,48,48,49,99,14,117,110,105,99,111,100,101,35,48,120,48,48,49,100,14,117,110,105,99,111,100,101,35,48,120,48,48,49,101,14,
+117,110,105,99,111,100,101,35,48,120,48,48,49,102,6,100,101,108,101,116,101,4,69,117,114,111,14,117,110,105,99,111,100,101,35,48,120,48,48,56,49,14,117,110,105,99,111,100,101,35,48,120,48,48,56,50,14,117,110,105,99,111,100,101,35,48,120,48,48,56,51,14,
+117,110,105,99,111,100,101,35,48,120,48,48,56,52,14,117,110,105,99,111,100,101,35,48,120,48,48,56,53,14,117,110,105,99,111,100,101,35,48,120,48,48,56,54,14,117,110,105,99,111,100,101,35,48,120,48,48,56,55,14,117,110,105,99,111,100,101,35,48,120,48,48,
+56,56,14,117,110,105,99,111,100,101,35,48,120,48,48,56,57,14,117,110,105,99,111,100,101,35,48,120,48,48,56,97,14,117,110,105,99,111,100,101,35,48,120,48,48,56,98,14,117,110,105,99,111,100,101,35,48,120,48,48,56,99,14,117,110,105,99,111,100,101,35,48,
+120,48,48,56,100,14,117,110,105,99,111,100,101,35,48,120,48,48,56,101,14,117,110,105,99,111,100,101,35,48,120,48,48,56,102,14,117,110,105,99,111,100,101,35,48,120,48,48,57,48,14,117,110,105,99,111,100,101,35,48,120,48,48,57,49,14,117,110,105,99,111,100,
+101,35,48,120,48,48,57,50,14,117,110,105,99,111,100,101,35,48,120,48,48,57,51,14,117,110,105,99,111,100,101,35,48,120,48,48,57,52,14,117,110,105,99,111,100,101,35,48,120,48,48,57,53,14,117,110,105,99,111,100,101,35,48,120,48,48,57,54,14,117,110,105,99,
+111,100,101,35,48,120,48,48,57,55,14,117,110,105,99,111,100,101,35,48,120,48,48,57,56,14,117,110,105,99,111,100,101,35,48,120,48,48,57,57,14,117,110,105,99,111,100,101,35,48,120,48,48,57,97,14,117,110,105,99,111,100,101,35,48,120,48,48,57,98,14,117,110,
+105,99,111,100,101,35,48,120,48,48,57,99,14,117,110,105,99,111,100,101,35,48,120,48,48,57,100,14,117,110,105,99,111,100,101,35,48,120,48,48,57,101,14,117,110,105,99,111,100,101,35,48,120,48,48,57,102,0,0,0,0 };
+
+const char* ProggyClean_ttf = (const char*) temp_6d1849c0;
+
+
+const char* getNamedResource (const char*, int&) throw();
+const char* getNamedResource (const char* resourceNameUTF8, int& numBytes) throw()
+{
+    unsigned int hash = 0;
+    if (resourceNameUTF8 != 0)
+        while (*resourceNameUTF8 != 0)
+            hash = 31 * hash + (unsigned int) *resourceNameUTF8++;
+
+    switch (hash)
+    {
+        case 0x52fe7f74:  numBytes = 940; return locked_png;
+        case 0xd173e2cd:  numBytes = 948; return unlocked_png;
+        case 0x33567627:  numBytes = 519; return waveform_png;
+        case 0x9c8584fa:  numBytes = 447; return pattern_png;
+        case 0xb6d73664:  numBytes = 41208; return ProggyClean_ttf;
+        default: break;
+    }
+
+    numBytes = 0;
+    return 0;
+}
+
+}
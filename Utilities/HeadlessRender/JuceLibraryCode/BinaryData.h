@@ -0,0 +1,27 @@
+/* =========================================================================================
+
+   This is an auto-generated file: Any edits you make may be overwritten!
+
+*/
+
+namespace BinaryData
+{
+    extern const char*   locked_png;
+    const int            locked_pngSize = 940;
+
+    extern const char*   unlocked_png;
+    const int            unlocked_pngSize = 948;
+
+    extern const char*   waveform_png;
+    const int            waveform_pngSize = 519;
+
+    extern const char*   pattern_png;
+    const int            pattern_pngSize = 447;
+
+    extern const char*   ProggyClean_ttf;
+    const int            ProggyClean_ttfSize = 41208;
+
+    // If you provide the name of one of the binary resource variables above, this function will
+    // return the corresponding data and its size (or a null pointer if the name isn't found).
+    const char* getNamedResource (const char* resourceNameUTF8, int& dataSizeInBytes) throw();
+}
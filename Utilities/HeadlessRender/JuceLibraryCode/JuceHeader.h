@@ -0,0 +1,41 @@
+/*
+
+    IMPORTANT! This file is auto-generated each time you save your
+    project - if you alter its contents, your changes may be overwritten!
+
+    This is the header file that your files should include in order to get all the
+    JUCE library headers. You should avoid including the JUCE headers directly in
+    your own source files, because that wouldn't pick up the correct configuration
+    options for your app.
+
+*/
+
+#ifndef __APPHEADERFILE_HR9X2K__
+#define __APPHEADERFILE_HR9X2K__
+
+#include "AppConfig.h"
+#include "../../../JuceLibraryCode/modules/juce_audio_basics/juce_audio_basics.h"
+#include "../../../JuceLibraryCode/modules/juce_audio_formats/juce_audio_formats.h"
+#include "../../../JuceLibraryCode/modules/juce_audio_processors/juce_audio_processors.h"
+#include "../../../JuceLibraryCode/modules/juce_core/juce_core.h"
+#include "../../../JuceLibraryCode/modules/juce_data_structures/juce_data_structures.h"
+#include "../../../JuceLibraryCode/modules/juce_events/juce_events.h"
+#include "../../../JuceLibraryCode/modules/juce_graphics/juce_graphics.h"
+#include "../../../JuceLibraryCode/modules/juce_gui_basics/juce_gui_basics.h"
+#include "../../../JuceLibraryCode/modules/juce_gui_extra/juce_gui_extra.h"
+#include "BinaryData.h"
+
+#if ! DONT_SET_USING_JUCE_NAMESPACE
+ // If your code uses a lot of JUCE classes, then this will obviously save you
+ // a lot of typing, but can be disabled by setting DONT_SET_USING_JUCE_NAMESPACE.
+ using namespace juce;
+#endif
+
+namespace ProjectInfo
+{
+    const char* const  projectName    = "HeadlessRender";
+    const char* const  versionString  = "1.0.0";
+    const int          versionNumber  = 0x10000;
+}
+
+#endif   // __APPHEADERFILE_HR9X2K__
@@ -0,0 +1,672 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 19 Oct 2026 4:48:33am
+    Author:  hemmer
+
+    Runs mlrVSTAudioProcessor without a host or a monome, so that changes
+    to the audio engine can be checked and timed from the command line.
+
+        HeadlessRender render <setlist.xml> <timeline.txt> <out.wav>
+                              [setlistItem] [blockSize] [sampleRate]
+
+    loads the setlist item (0 by default) and replays the timeline of
+    presses into processOSCKeyPress, rendering to a wav as fast as
+    possible. Each line of the timeline is
+
+        <seconds> <monome column> <monome row> <1 = down, 0 = up>
+
+    ('#' starts a comment). Offline there is no real clock to time the
+    presses against, so each is given the sample it falls on, and a
+    timeline always renders the same however fast it runs.
+
+        HeadlessRender bench [secondsPerRun]
+
+    plays a noise sample on different numbers of strips, at different
+    play speeds and block sizes, and reports how long the processBlock
+    took per sample per strip.
+
+        HeadlessRender latency [numPresses] [blockSize] [quantiseMenuSelection]
+
+    stands in for serialosc: presses are sent over UDP to the port
+    OSCHandler listens on (8000) while the processor runs in real time on
+    its own thread, as if a sound card were calling it. The onset of each
+    press is found in the rendered audio and the first LED update lighting
+    the strip is picked up on the port LEDs are sent to (8080), giving
+    the distribution of press-to-sound and press-to-LED times. Each block
+    is taken as being heard one block after it was asked for (i.e. a
+    double buffered device), so real latencies will be higher by however
+    much more buffering the device adds.
+
+  ==============================================================================
+*/
+
+#include "../../../Source/PluginProcessor.h"
+#include "../../../Source/AudioSample.h"
+#include "../../../Source/SampleStrip.h"
+
+#include "osc/OscOutboundPacketStream.h"
+#include "osc/OscPacketListener.h"
+#include "ip/UdpSocket.h"
+
+
+namespace
+{
+    const double defaultSampleRate = 44100.0;
+    const int defaultBlockSize = 512;
+
+    struct TimelinePress
+    {
+        double time;
+        int col, row;
+        bool state;
+    };
+
+    struct PressSorter
+    {
+        static int compareElements(const TimelinePress &a, const TimelinePress &b)
+        {
+            return (a.time < b.time) ? -1 : ((b.time < a.time) ? 1 : 0);
+        }
+    };
+
+    bool loadTimeline(const File &timelineFile, Array<TimelinePress> &presses)
+    {
+        if (!timelineFile.existsAsFile()) return false;
+
+        StringArray lines;
+        timelineFile.readLines(lines);
+
+        for (int l = 0; l < lines.size(); ++l)
+        {
+            const String line(lines[l].upToFirstOccurrenceOf("#", false, false).trim());
+            if (line.isEmpty()) continue;
+
+            StringArray tokens;
+            tokens.addTokens(line, " \t", String::empty);
+            tokens.removeEmptyStrings();
+
+            if (tokens.size() != 4)
+            {
+                std::cerr << "line " << (l + 1) << " of the timeline should be <seconds> <col> <row> <state>" << std::endl;
+                return false;
+            }
+
+            TimelinePress press;
+            press.time = tokens[0].getDoubleValue();
+            press.col = tokens[1].getIntValue();
+            press.row = tokens[2].getIntValue();
+            press.state = tokens[3].getIntValue() != 0;
+            presses.add(press);
+        }
+
+        // (they don't have to be in order in the file)
+        PressSorter sorter;
+        presses.sort(sorter, true);
+
+        return true;
+    }
+
+    void prepareProcessor(mlrVSTAudioProcessor &processor, const double &sampleRate, const int &blockSize)
+    {
+        processor.setPlayConfigDetails(2, 2, sampleRate, blockSize);
+        processor.prepareToPlay(sampleRate, blockSize);
+    }
+
+    // lets the message thread finish off any background loads
+    void waitForSampleLoads(mlrVSTAudioProcessor &processor)
+    {
+        const uint32 timeOut = Time::getMillisecondCounter() + 60000;
+
+        while (processor.getNumPendingSampleLoads() > 0 && Time::getMillisecondCounter() < timeOut)
+            MessageManager::getInstance()->runDispatchLoopUntil(10);
+
+        // (the strips are given their samples by messages)
+        MessageManager::getInstance()->runDispatchLoopUntil(50);
+    }
+
+
+    // Render ///////////////////////////////////////////////////////
+
+    int render(const StringArray &args)
+    {
+        if (args.size() < 4)
+        {
+            std::cerr << "usage: HeadlessRender render <setlist.xml> <timeline.txt> <out.wav> "
+                         "[setlistItem] [blockSize] [sampleRate]" << std::endl;
+            return 1;
+        }
+
+        const File setlistFile(File::getCurrentWorkingDirectory().getChildFile(args[1]));
+        const File timelineFile(File::getCurrentWorkingDirectory().getChildFile(args[2]));
+        const File outputFile(File::getCurrentWorkingDirectory().getChildFile(args[3]));
+        const int setlistItem = (args.size() > 4) ? args[4].getIntValue() : 0;
+        const int blockSize = (args.size() > 5) ? jmax(1, args[5].getIntValue()) : defaultBlockSize;
+        const double sampleRate = (args.size() > 6) ? args[6].getDoubleValue() : defaultSampleRate;
+
+        Array<TimelinePress> presses;
+        if (!loadTimeline(timelineFile, presses))
+        {
+            std::cerr << "couldn't read the timeline: " << timelineFile.getFullPathName() << std::endl;
+            return 1;
+        }
+
+        mlrVSTAudioProcessor processor;
+
+        if (!processor.loadXmlSetlist(setlistFile))
+        {
+            std::cerr << "couldn't load the setlist: " << setlistFile.getFullPathName() << std::endl;
+            return 1;
+        }
+        // (loading a setlist puts its presets in the preset list, in order)
+        processor.selectPresetListItem(setlistItem);
+        waitForSampleLoads(processor);
+
+        prepareProcessor(processor, sampleRate, blockSize);
+
+        outputFile.deleteFile();
+        ScopedPointer<FileOutputStream> outStream(outputFile.createOutputStream());
+        if (outStream == nullptr)
+        {
+            std::cerr << "couldn't write to: " << outputFile.getFullPathName() << std::endl;
+            return 1;
+        }
+
+        WavAudioFormat wavFormat;
+        ScopedPointer<AudioFormatWriter> writer(wavFormat.createWriterFor(outStream, sampleRate, 2, 24,
+                                                                          StringPairArray(), 0));
+        if (writer == nullptr) return 1;
+        outStream.release();    // (the writer has it now)
+
+        // carry on a couple of seconds after the last press
+        const double lastPressTime = (presses.size() > 0) ? presses.getLast().time : 0.0;
+        const int64 totalSamples = (int64) ((lastPressTime + 2.0) * sampleRate);
+
+        AudioSampleBuffer buffer(2, blockSize);
+        MidiBuffer midi;
+        int nextPress = 0;
+        int64 position = 0;
+
+        const double startTime = Time::getMillisecondCounterHiRes();
+
+        while (position < totalSamples)
+        {
+            const int numSamples = (int) jmin((int64) blockSize, totalSamples - position);
+            const double blockEndTime = (position + numSamples) / sampleRate;
+
+            // everything pressed before the end of this block, at
+            // the sample it was pressed on (rather than the wall clock)
+            while (nextPress < presses.size() && presses.getReference(nextPress).time < blockEndTime)
+            {
+                const TimelinePress &press = presses.getReference(nextPress++);
+                const int64 pressSample = (int64) (press.time * sampleRate);
+                const int offset = (int) jlimit((int64) 0, (int64) numSamples - 1, pressSample - position);
+                processor.processOSCKeyPress(press.col, press.row, press.state, offset);
+            }
+
+            buffer.setSize(2, numSamples, false, false, true);
+            buffer.clear();
+            midi.clear();
+
+            processor.processBlock(buffer, midi);
+            writer->writeFromAudioSampleBuffer(buffer, 0, numSamples);
+
+            position += numSamples;
+        }
+
+        const double renderSeconds = (Time::getMillisecondCounterHiRes() - startTime) / 1000.0;
+        const double audioSeconds = totalSamples / sampleRate;
+
+        std::cout << "rendered " << audioSeconds << "s of audio in " << renderSeconds << "s ("
+                  << (renderSeconds > 0.0 ? audioSeconds / renderSeconds : 0.0) << "x real time) to "
+                  << outputFile.getFullPathName() << std::endl;
+
+        return 0;
+    }
+
+
+    // Benchmark ////////////////////////////////////////////////////
+
+    int bench(const StringArray &args)
+    {
+        const double secondsPerRun = (args.size() > 1) ? jmax(0.1, args[1].getDoubleValue()) : 4.0;
+        const double sampleRate = defaultSampleRate;
+
+        // row 0 is the top row, so one strip fewer than the rows
+        const int stripCounts[] = { 1, 4, 8, 15 };
+        const double playSpeeds[] = { 0.5, 1.0, 1.37, 2.0 };
+
+        // ten seconds of noise (in memory), shared by every strip
+        ScopedPointer<AudioSample> noise(new AudioSample(sampleRate, (int) (10.0 * sampleRate),
+                                                         "bench noise", AudioSample::tFileSample));
+        Random random(1234);
+        for (int c = 0; c < noise->getAudioData()->getNumChannels(); ++c)
+        {
+            float *data = noise->getAudioData()->getSampleData(c);
+            for (int i = 0; i < noise->getAudioData()->getNumSamples(); ++i)
+                data[i] = random.nextFloat() * 0.5f - 0.25f;
+        }
+        noise->audioDataChanged();
+
+        mlrVSTAudioProcessor processor;
+        const int monomeSize = GlobalSettings::sixteenBySixteen;
+        processor.setGlobalSetting(GlobalSettings::sMonomeSize, &monomeSize);
+
+        std::cout << "strips\tspeed\tblock\tns/sample/strip" << std::endl;
+
+        for (int s = 0; s < numElementsInArray(stripCounts); ++s)
+        {
+            const int numStrips = stripCounts[s];
+            processor.setGlobalSetting(GlobalSettings::sNumSampleStrips, &numStrips);
+
+            for (int p = 0; p < numElementsInArray(playSpeeds); ++p)
+            {
+                for (int blockSize = 16; blockSize <= 2048; blockSize *= 2)
+                {
+                    prepareProcessor(processor, sampleRate, blockSize);
+
+                    AudioSampleBuffer buffer(2, blockSize);
+                    MidiBuffer midi;
+
+                    // start every strip looping from the first column
+                    for (int strip = 0; strip < numStrips; ++strip)
+                    {
+                        processor.setSampleStripParameter(SampleStrip::pAudioSample, noise.get(), strip);
+                        const double speed = playSpeeds[p];
+                        processor.getSampleStrip(strip)->setSampleStripParam<SampleStrip::pPlaySpeed>(speed);
+                        const int playMode = SampleStrip::LOOP;
+                        processor.setSampleStripParameter(SampleStrip::pPlayMode, &playMode, strip);
+
+                        processor.processOSCKeyPress(0, strip + 1, true);
+                        processor.processOSCKeyPress(0, strip + 1, false);
+                    }
+
+                    // (a few blocks for the presses to arrive and the strips to start)
+                    for (int i = 0; i < 8; ++i)
+                    {
+                        buffer.clear();
+                        midi.clear();
+                        processor.processBlock(buffer, midi);
+                    }
+
+                    const int numBlocks = jmax(1, (int) (secondsPerRun * sampleRate / blockSize));
+                    const int64 startTicks = Time::getHighResolutionTicks();
+
+                    for (int i = 0; i < numBlocks; ++i)
+                    {
+                        buffer.clear();
+                        midi.clear();
+                        processor.processBlock(buffer, midi);
+                    }
+
+                    const double seconds = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - startTicks);
+                    const double nsPerSample = seconds * 1.0e9 / ((double) numBlocks * blockSize * numStrips);
+
+                    std::cout << numStrips << "\t" << playSpeeds[p] << "\t" << blockSize << "\t"
+                              << String(nsPerSample, 2) << std::endl;
+
+                    processor.stopAllStrips(0);
+                }
+            }
+        }
+
+        // (the processor is deleted first, so the strips
+        // have let go of the noise before it's deleted)
+        return 0;
+    }
+
+
+    // Latency //////////////////////////////////////////////////////
+
+    const int gridPort = 8000;      // where OSCHandler listens for presses...
+    const int ledPort = 8080;       // ...and where it sends the LEDs
+
+    // Runs processBlock in real time, as a sound card would, noting
+    // when each run of sound starts (in ms, see above).
+    class LatencyAudioThread : public Thread
+    {
+    public:
+        LatencyAudioThread(mlrVSTAudioProcessor &owner, const double &rate, const int &size) :
+            Thread("HeadlessRender audio"),
+            processor(owner), sampleRate(rate), blockSize(size), onsetTimes()
+        {
+        }
+
+        void run()
+        {
+            const double threshold = 1.0e-3;
+            // how long it has to be quiet before the next sound counts
+            const int silenceNeeded = (int) (0.01 * sampleRate);
+
+            AudioSampleBuffer buffer(2, blockSize);
+            MidiBuffer midi;
+            int numSilent = silenceNeeded;
+
+            const double blockPeriod = 1000.0 * blockSize / sampleRate;
+            double nextCallback = Time::getMillisecondCounterHiRes();
+
+            while (!threadShouldExit())
+            {
+                Time::waitForMillisecondCounter((uint32) nextCallback);
+                const double callbackTime = Time::getMillisecondCounterHiRes();
+                nextCallback += blockPeriod;
+
+                buffer.clear();
+                midi.clear();
+                processor.processBlock(buffer, midi);
+
+                const float *left = buffer.getSampleData(0);
+                const float *right = buffer.getSampleData(1);
+
+                for (int i = 0; i < blockSize; ++i)
+                {
+                    if (std::abs(left[i]) > threshold || std::abs(right[i]) > threshold)
+                    {
+                        if (numSilent >= silenceNeeded)
+                            onsetTimes.add(callbackTime + 1000.0 * (blockSize + i) / sampleRate);
+
+                        numSilent = 0;
+                    }
+                    else
+                        ++numSilent;
+                }
+            }
+        }
+
+        mlrVSTAudioProcessor &processor;
+        const double sampleRate;
+        const int blockSize;
+
+        // (only read once the thread has stopped)
+        Array<double> onsetTimes;
+    };
+
+    // Listens for the LED messages, noting when the strip's row lights up.
+    class LEDListener : public Thread, public osc::OscPacketListener
+    {
+    public:
+        LEDListener(const int &rowToWatch) :
+            Thread("HeadlessRender LEDs"),
+            socket(IpEndpointName(IpEndpointName::ANY_ADDRESS, ledPort), this),
+            row(rowToWatch), isRowLit(false), litTimes()
+        {
+        }
+
+        ~LEDListener()
+        {
+            socket.AsynchronousBreak();
+            stopThread(2000);
+        }
+
+        void run()
+        {
+            socket.Run();
+        }
+
+        void ProcessMessage(const osc::ReceivedMessage &m, const IpEndpointName & /*remoteEndpoint*/)
+        {
+            try
+            {
+                const String address(m.AddressPattern());
+                osc::ReceivedMessageArgumentStream args = m.ArgumentStream();
+                osc::int32 x, y, mask;
+                int lit = -1;
+
+                if (address.endsWith("/led_row"))
+                {
+                    // y, then one mask per 8 LEDs
+                    args >> y;
+                    if (y != row) return;
+
+                    lit = 0;
+                    while (!args.Eos())
+                    {
+                        args >> mask;
+                        lit |= mask;
+                    }
+                }
+                else if (address.endsWith("/frame"))
+                {
+                    // x offset, y offset, then 8 row masks (the
+                    // strip only plays its first chunk, so x is 0)
+                    args >> x >> y;
+                    if (x != 0 || row < y || row >= y + 8) return;
+
+                    for (int r = y; r <= row; ++r)
+                        args >> mask;
+                    lit = mask;
+                }
+                else if (address.endsWith("/clear"))
+                    lit = 0;
+
+                if (lit < 0) return;
+
+                if (lit != 0 && !isRowLit)
+                    litTimes.add(Time::getMillisecondCounterHiRes());
+
+                isRowLit = (lit != 0);
+            }
+            catch (osc::Exception &e)
+            {
+                std::cerr << "bad LED message: " << e.what() << std::endl;
+            }
+        }
+
+        UdpListeningReceiveSocket socket;
+        const int row;
+        bool isRowLit;
+
+        // (only read once the thread has stopped)
+        Array<double> litTimes;
+    };
+
+    /* Presses a button every so often, like someone at the grid. Each
+       press waits for the last one's sound (which can be held back by up
+       to maxDelayMs when quantising) so they can't be mixed up.
+    */
+    class GridPresser : public Thread
+    {
+    public:
+        GridPresser(const String &prefix, const int &col, const int &row, const int &presses,
+                    const int &maxDelayMs) :
+            Thread("HeadlessRender grid"),
+            socket(IpEndpointName("localhost", gridPort)),
+            pressAddress("/" + prefix + "/press"),
+            column(col), gridRow(row), numPresses(presses), maxDelay(maxDelayMs), pressTimes()
+        {
+        }
+
+        void run()
+        {
+            Random random(4321);
+
+            for (int i = 0; i < numPresses && !threadShouldExit(); ++i)
+            {
+                // at random times, so the presses land all over the blocks
+                Thread::sleep(maxDelay + 250 + random.nextInt(200));
+
+                pressTimes.add(Time::getMillisecondCounterHiRes());
+                send(true);
+
+                Thread::sleep(20);
+                send(false);
+            }
+        }
+
+        void send(const bool &state)
+        {
+            char buffer[256];
+            osc::OutboundPacketStream p(buffer, sizeof(buffer));
+
+            p << osc::BeginMessage(pressAddress.toUTF8())
+              << (osc::int32) column << (osc::int32) gridRow << (osc::int32) (state ? 1 : 0)
+              << osc::EndMessage;
+
+            socket.Send(p.Data(), p.Size());
+        }
+
+        UdpTransmitSocket socket;
+        const String pressAddress;
+        const int column, gridRow, numPresses, maxDelay;
+
+        // (only read once the thread has stopped)
+        Array<double> pressTimes;
+    };
+
+    /* Works out how long after each press the first of events happened
+       (ignoring any press which had nothing before the next one).
+    */
+    void matchToPresses(const Array<double> &pressTimes, const Array<double> &events, Array<double> &delays)
+    {
+        int e = 0;
+
+        for (int p = 0; p < pressTimes.size(); ++p)
+        {
+            const double nextPress = (p + 1 < pressTimes.size()) ? pressTimes[p + 1] : 1.0e300;
+
+            while (e < events.size() && events[e] < pressTimes[p])
+                ++e;
+
+            if (e < events.size() && events[e] < nextPress)
+                delays.add(events[e] - pressTimes[p]);
+        }
+    }
+
+    void printDistribution(const String &name, Array<double> delays, const int &numPresses)
+    {
+        std::cout << name << ": ";
+
+        if (delays.size() == 0)
+        {
+            std::cout << "nothing detected" << std::endl;
+            return;
+        }
+
+        DefaultElementComparator<double> sorter;
+        delays.sort(sorter);
+
+        double total = 0.0;
+        for (int i = 0; i < delays.size(); ++i)
+            total += delays[i];
+
+        const int last = delays.size() - 1;
+
+        std::cout << delays.size() << "/" << numPresses << " detected, ms"
+                  << "  min " << String(delays[0], 2)
+                  << "  median " << String(delays[last / 2], 2)
+                  << "  p90 " << String(delays[(last * 9) / 10], 2)
+                  << "  p99 " << String(delays[(last * 99) / 100], 2)
+                  << "  max " << String(delays[last], 2)
+                  << "  mean " << String(total / delays.size(), 2) << std::endl;
+    }
+
+    int latency(const StringArray &args)
+    {
+        const int numPresses = (args.size() > 1) ? jmax(1, args[1].getIntValue()) : 100;
+        const int blockSize = (args.size() > 2) ? jmax(1, args[2].getIntValue()) : defaultBlockSize;
+        const int quantiseSelection = (args.size() > 3) ? jlimit(1, 7, args[3].getIntValue()) : 1;
+        const double sampleRate = defaultSampleRate;
+
+        const int gridRow = 1;      // (the first strip)
+
+        // (declared first, so the strip has let go of it before it's deleted)
+        ScopedPointer<AudioSample> level;
+
+        mlrVSTAudioProcessor processor;
+        processor.setGlobalSetting(GlobalSettings::sQuantiseMenuSelection, &quantiseSelection);
+
+        // Each press plays one chunk (of 100ms) of a constant level,
+        // so the onset is easy to find and there's silence in between.
+        const int numChunks = processor.getSampleStrip(0)->getSampleStripParam<SampleStrip::pNumChunks>();
+        level = new AudioSample(sampleRate, (int) (numChunks * 0.1 * sampleRate),
+                                "latency level", AudioSample::tFileSample);
+        for (int c = 0; c < level->getAudioData()->getNumChannels(); ++c)
+        {
+            float *data = level->getAudioData()->getSampleData(c);
+            for (int i = 0; i < level->getAudioData()->getNumSamples(); ++i)
+                data[i] = 0.5f;
+        }
+        level->audioDataChanged();
+
+        processor.setSampleStripParameter(SampleStrip::pAudioSample, level.get(), 0);
+        const int playMode = SampleStrip::PLAY_CHUNK_ONCE;
+        processor.setSampleStripParameter(SampleStrip::pPlayMode, &playMode, 0);
+
+        prepareProcessor(processor, sampleRate, blockSize);
+
+        // the longest a quantised press can wait for the next grid line
+        // (the scheduler's grid is twice the quantise level, in beats)
+        const double quantiseLevel = processor.getGlobalSetting<GlobalSettings::sQuantiseLevel>();
+        const double bpm = processor.getGlobalSetting<GlobalSettings::sCurrentBPM>();
+        const int maxQuantiseDelayMs = (quantiseLevel > 0.0) ? roundToInt(2.0 * quantiseLevel * 60000.0 / bpm) : 0;
+
+        std::cout << "sending " << numPresses << " presses to port " << gridPort
+                  << " (block " << blockSize << " at " << sampleRate << "Hz, quantise menu "
+                  << quantiseSelection << ", up to " << maxQuantiseDelayMs << "ms late)" << std::endl;
+
+        Array<double> soundDelays, ledDelays;
+
+        try
+        {
+            LEDListener ledListener(gridRow);
+            LatencyAudioThread audioThread(processor, sampleRate, blockSize);
+            GridPresser presser(processor.getGlobalSetting<GlobalSettings::sOSCPrefix>(), 0, gridRow, numPresses,
+                                maxQuantiseDelayMs);
+
+            ledListener.startThread(8);
+            audioThread.startThread(9);
+
+            // let the LEDs settle before the first press
+            MessageManager::getInstance()->runDispatchLoopUntil(500);
+            presser.startThread(8);
+
+            // (the LED frames are drawn by timers on this thread)
+            while (presser.isThreadRunning())
+                MessageManager::getInstance()->runDispatchLoopUntil(20);
+
+            // give the last press time to sound
+            MessageManager::getInstance()->runDispatchLoopUntil(maxQuantiseDelayMs + 500);
+
+            audioThread.stopThread(2000);
+            ledListener.socket.AsynchronousBreak();
+            ledListener.stopThread(2000);
+
+            matchToPresses(presser.pressTimes, audioThread.onsetTimes, soundDelays);
+            matchToPresses(presser.pressTimes, ledListener.litTimes, ledDelays);
+        }
+        catch (std::exception &e)
+        {
+            // (most likely something else has one of the ports)
+            std::cerr << "couldn't run the latency test: " << e.what() << std::endl;
+            return 1;
+        }
+
+        printDistribution("press to sound", soundDelays, numPresses);
+        printDistribution("press to LED  ", ledDelays, numPresses);
+
+        return 0;
+    }
+}
+
+
+int main(int argc, char* argv[])
+{
+    ScopedJuceInitialiser_GUI juceSystem;
+
+    StringArray args;
+    for (int i = 1; i < argc; ++i)
+        args.add(CharPointer_UTF8(argv[i]));
+
+    if (args[0] == "render")
+        return render(args);
+    else if (args[0] == "bench")
+        return bench(args);
+    else if (args[0] == "latency")
+        return latency(args);
+
+    std::cerr << "usage: HeadlessRender render <setlist.xml> <timeline.txt> <out.wav> [setlistItem] [blockSize] [sampleRate]\n"
+                 "       HeadlessRender bench [secondsPerRun]\n"
+                 "       HeadlessRender latency [numPresses] [blockSize] [quantiseMenuSelection]" << std::endl;
+    return 1;
+}